@@ -0,0 +1,345 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#endif
+
+#include "s21_math.h"
+#include "utils.h"
+
+// Отправители кладут задания в кольцо без блокировок (ограниченная очередь
+// Вьюкова: у каждой ячейки свой номер, захват слота — CAS хвоста). Забирает
+// из кольца тот рабочий, что держит мьютекс очереди, поэтому потребитель
+// всегда один. За один заход рабочий снимает несколько заданий, пока их
+// суммарная длина не превысит batch, и выполняет их без мьютекса: на
+// мелких заданиях пробуждение и захват мьютекса делятся на всю пачку.
+
+#define S21_ASYNC_CAPACITY 1024
+#define S21_ASYNC_BATCH 65536
+#define S21_ASYNC_MAX_WORKERS 64
+#define S21_ASYNC_MAX_BATCH_JOBS 64
+
+enum { S21_JOB_QUEUED, S21_JOB_RUNNING, S21_JOB_DONE };
+
+struct s21_async_job {
+  s21_async_fn fn;
+  const double *x, *y;
+  double *res;
+  size_t n;
+  double submitted;
+  s21_fp_mode mode;  // режим отправителя
+  atomic_int state;
+};
+
+typedef struct {
+  atomic_size_t seq;
+  s21_async_job *job;
+} s21_async_cell;
+
+struct s21_async_queue {
+  s21_async_cell *cells;
+  size_t mask;
+  atomic_size_t tail;
+  size_t head;     // под lock
+  size_t batches;  // под lock
+  size_t batch;
+  size_t max_pending;
+  atomic_size_t pending;  // элементов в очереди и в работе
+  atomic_size_t depth;    // заданий в кольце
+  atomic_int sleepers;
+  int stop, paused;
+  pthread_mutex_t lock;
+  pthread_cond_t work;
+  pthread_mutex_t done_lock;  // также защищает stats
+  pthread_cond_t done;
+  s21_async_stats stats;
+  int event_fd;
+  int workers;
+  pthread_t tids[S21_ASYNC_MAX_WORKERS];
+};
+
+static const s21_batch_fn s21_async_unary[S21_ASYNC_COUNT] = {
+    [S21_ASYNC_COS] = s21_cos_n,     [S21_ASYNC_EXP] = s21_exp_n,
+    [S21_ASYNC_EXP2] = s21_exp2_n,   [S21_ASYNC_EXPM1] = s21_expm1_n,
+    [S21_ASYNC_LOG] = s21_log_n,     [S21_ASYNC_LOG1P] = s21_log1p_n,
+    [S21_ASYNC_LOG2] = s21_log2_n,   [S21_ASYNC_LOG10] = s21_log10_n,
+    [S21_ASYNC_RSQRT] = s21_rsqrt_n, [S21_ASYNC_SIN] = s21_sin_n,
+    [S21_ASYNC_SQRT] = s21_sqrt_n,   [S21_ASYNC_TAN] = s21_tan_n};
+
+static double s21_async_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int s21_async_push(s21_async_queue *q, s21_async_job *job) {
+  size_t pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+  s21_async_cell *cell = NULL;
+  while (cell == NULL) {
+    s21_async_cell *c = &q->cells[pos & q->mask];
+    size_t seq = atomic_load_explicit(&c->seq, memory_order_acquire);
+    ptrdiff_t diff = (ptrdiff_t)(seq - pos);
+    if (diff == 0 && atomic_compare_exchange_weak_explicit(
+                         &q->tail, &pos, pos + 1, memory_order_relaxed,
+                         memory_order_relaxed)) {
+      cell = c;
+    } else if (diff < 0) {
+      return -1;  // кольцо заполнено
+    } else if (diff > 0) {
+      pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    }
+  }
+  cell->job = job;
+  atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+  return 0;
+}
+
+// вызывается только под q->lock
+static s21_async_job *s21_async_pop(s21_async_queue *q) {
+  s21_async_cell *c = &q->cells[q->head & q->mask];
+  size_t seq = atomic_load_explicit(&c->seq, memory_order_acquire);
+  s21_async_job *job = NULL;
+  if (seq == q->head + 1) {
+    job = c->job;
+    atomic_store_explicit(&c->seq, q->head + q->mask + 1,
+                          memory_order_release);
+    q->head++;
+    atomic_fetch_sub(&q->depth, 1);
+  }
+  return job;
+}
+
+static void s21_async_run(s21_async_queue *q, s21_async_job *job) {
+  double start = s21_async_now();
+  int pushed = s21_fp_mode_push(job->mode) == 0;
+  if (job->fn == S21_ASYNC_POW) {
+    s21_pow_n(job->x, job->y, job->res, job->n);
+  } else {
+    s21_async_unary[job->fn](job->x, job->res, job->n);
+  }
+  if (pushed) s21_fp_mode_pop();
+  double end = s21_async_now();
+  atomic_fetch_sub(&q->pending, job->n);
+  // eventfd сигналится до отметки о готовности: к возврату из wait
+  // счётчик уже учитывает это задание
+#if defined(__linux__)
+  uint64_t one = 1;
+  if (write(q->event_fd, &one, sizeof(one)) < 0) {
+    // счётчик eventfd переполнен: ожидающий всё равно проснётся
+  }
+#endif
+  pthread_mutex_lock(&q->done_lock);
+  s21_async_stats *st = &q->stats;
+  st->completed++;
+  st->service_time += end - start;
+  st->latency += end - job->submitted;
+  if (end - start > st->max_service_time) st->max_service_time = end - start;
+  if (end - job->submitted > st->max_latency) {
+    st->max_latency = end - job->submitted;
+  }
+  atomic_store_explicit(&job->state, S21_JOB_DONE, memory_order_release);
+  pthread_cond_broadcast(&q->done);
+  pthread_mutex_unlock(&q->done_lock);
+}
+
+static void *s21_async_worker(void *arg) {
+  s21_async_queue *q = arg;
+  s21_async_job *batch[S21_ASYNC_MAX_BATCH_JOBS];
+  pthread_mutex_lock(&q->lock);
+  for (;;) {
+    int count = 0;
+    size_t elements = 0;
+    while (!q->paused && count < S21_ASYNC_MAX_BATCH_JOBS &&
+           elements < q->batch) {
+      s21_async_job *job = s21_async_pop(q);
+      if (job == NULL) break;
+      atomic_store(&job->state, S21_JOB_RUNNING);
+      batch[count++] = job;
+      elements += job->n;
+    }
+    if (count > 0) {
+      q->batches++;
+      pthread_mutex_unlock(&q->lock);
+      for (int i = 0; i < count; i++) s21_async_run(q, batch[i]);
+      pthread_mutex_lock(&q->lock);
+    } else if (q->stop && atomic_load(&q->depth) == 0) {
+      break;
+    } else {
+      // sleepers увеличивается до повторной проверки кольца: отправитель,
+      // положивший задание после неё, увидит спящего и разбудит его
+      atomic_fetch_add(&q->sleepers, 1);
+      if (q->paused || atomic_load(&q->depth) == 0) {
+        pthread_cond_wait(&q->work, &q->lock);
+      }
+      atomic_fetch_sub(&q->sleepers, 1);
+    }
+  }
+  pthread_mutex_unlock(&q->lock);
+  return NULL;
+}
+
+static void s21_async_wake(s21_async_queue *q) {
+  pthread_mutex_lock(&q->lock);
+  pthread_cond_signal(&q->work);
+  pthread_mutex_unlock(&q->lock);
+}
+
+s21_async_queue *s21_async_create(const s21_async_config *cfg) {
+  s21_async_config c = {1, S21_ASYNC_CAPACITY, 0, S21_ASYNC_BATCH};
+  if (cfg != NULL) c = *cfg;
+  if (c.workers <= 0) c.workers = 1;
+  if (c.workers > S21_ASYNC_MAX_WORKERS) c.workers = S21_ASYNC_MAX_WORKERS;
+  if (c.batch == 0) c.batch = S21_ASYNC_BATCH;
+  size_t capacity = 2;
+  while (capacity < c.capacity) capacity *= 2;
+  if (c.capacity == 0) capacity = S21_ASYNC_CAPACITY;
+
+  s21_async_queue *q = calloc(1, sizeof(*q));
+  if (q != NULL) q->cells = malloc(capacity * sizeof(*q->cells));
+  if (q != NULL && q->cells == NULL) {
+    free(q);
+    q = NULL;
+  }
+  if (q != NULL) {
+    for (size_t i = 0; i < capacity; i++) atomic_init(&q->cells[i].seq, i);
+    q->mask = capacity - 1;
+    q->batch = c.batch;
+    q->max_pending = c.max_pending;
+    pthread_mutex_init(&q->lock, NULL);
+    pthread_cond_init(&q->work, NULL);
+    pthread_mutex_init(&q->done_lock, NULL);
+    pthread_cond_init(&q->done, NULL);
+    q->event_fd = -1;
+#if defined(__linux__)
+    q->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#endif
+    for (int t = 0; t < c.workers; t++) {
+      if (pthread_create(&q->tids[q->workers], NULL, s21_async_worker,
+                         q) == 0) {
+        q->workers++;
+      }
+    }
+    if (q->workers == 0) {
+      s21_async_destroy(q);
+      q = NULL;
+    }
+  }
+  return q;
+}
+
+void s21_async_destroy(s21_async_queue *q) {
+  if (q != NULL) {
+    pthread_mutex_lock(&q->lock);
+    q->stop = 1;
+    q->paused = 0;
+    pthread_cond_broadcast(&q->work);
+    pthread_mutex_unlock(&q->lock);
+    for (int t = 0; t < q->workers; t++) pthread_join(q->tids[t], NULL);
+    pthread_mutex_destroy(&q->lock);
+    pthread_cond_destroy(&q->work);
+    pthread_mutex_destroy(&q->done_lock);
+    pthread_cond_destroy(&q->done);
+    if (q->event_fd >= 0) close(q->event_fd);
+    free(q->cells);
+    free(q);
+  }
+}
+
+s21_async_job *s21_async_submit(s21_async_queue *q, s21_async_fn fn,
+                                const double *x, const double *y, double *res,
+                                size_t n) {
+  s21_async_job *job = NULL;
+  int status = 0;
+  if ((unsigned int)fn >= S21_ASYNC_COUNT || x == NULL || res == NULL ||
+      (fn == S21_ASYNC_POW && y == NULL)) {
+    status = EINVAL;
+  } else {
+    // лимит элементов не мешает одиночному большому заданию в пустой очереди
+    size_t before = atomic_fetch_add(&q->pending, n);
+    if (q->max_pending > 0 && before > 0 && before + n > q->max_pending) {
+      status = EAGAIN;
+    } else if ((job = malloc(sizeof(*job))) == NULL) {
+      status = ENOMEM;
+    }
+  }
+  if (status == 0) {
+    *job = (s21_async_job){
+        fn, x, y, res, n, s21_async_now(), s21_fp_mode_get(), 0};
+    atomic_init(&job->state, S21_JOB_QUEUED);
+    size_t depth = atomic_fetch_add(&q->depth, 1) + 1;
+    if (s21_async_push(q, job) == 0) {
+      pthread_mutex_lock(&q->done_lock);
+      q->stats.submitted++;
+      if (depth > q->stats.max_depth) q->stats.max_depth = depth;
+      pthread_mutex_unlock(&q->done_lock);
+      if (atomic_load(&q->sleepers) > 0) s21_async_wake(q);
+    } else {
+      atomic_fetch_sub(&q->depth, 1);
+      free(job);
+      job = NULL;
+      status = EAGAIN;
+    }
+  }
+  if (status != 0 && status != EINVAL) atomic_fetch_sub(&q->pending, n);
+  if (status == EAGAIN) {
+    pthread_mutex_lock(&q->done_lock);
+    q->stats.rejected++;
+    pthread_mutex_unlock(&q->done_lock);
+  }
+  if (status != 0) errno = status;
+  return job;
+}
+
+int s21_async_poll(const s21_async_job *job) {
+  return atomic_load_explicit((atomic_int *)&job->state,
+                              memory_order_acquire) == S21_JOB_DONE;
+}
+
+void s21_async_wait(s21_async_queue *q, const s21_async_job *job) {
+  if (!s21_async_poll(job)) {
+    pthread_mutex_lock(&q->done_lock);
+    while (!s21_async_poll(job)) pthread_cond_wait(&q->done, &q->done_lock);
+    pthread_mutex_unlock(&q->done_lock);
+  }
+}
+
+void s21_async_release(s21_async_queue *q, s21_async_job *job) {
+  if (job != NULL) {
+    s21_async_wait(q, job);
+    free(job);
+  }
+}
+
+int s21_async_eventfd(const s21_async_queue *q) { return q->event_fd; }
+
+void s21_async_pause(s21_async_queue *q) {
+  pthread_mutex_lock(&q->lock);
+  q->paused = 1;
+  pthread_mutex_unlock(&q->lock);
+}
+
+void s21_async_resume(s21_async_queue *q) {
+  pthread_mutex_lock(&q->lock);
+  q->paused = 0;
+  pthread_cond_broadcast(&q->work);
+  pthread_mutex_unlock(&q->lock);
+}
+
+void s21_async_get_stats(s21_async_queue *q, s21_async_stats *stats) {
+  pthread_mutex_lock(&q->lock);
+  size_t batches = q->batches;
+  pthread_mutex_unlock(&q->lock);
+  pthread_mutex_lock(&q->done_lock);
+  *stats = q->stats;
+  pthread_mutex_unlock(&q->done_lock);
+  stats->batches = batches;  // пачки считаются под lock, а не done_lock
+  stats->depth = atomic_load(&q->depth);
+  stats->pending = atomic_load(&q->pending);
+}
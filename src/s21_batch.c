@@ -0,0 +1,257 @@
+#include "s21_math.h"
+#include "utils.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define S21_CLEAN_BLOCK 256  // элементов на одну проверку s21_classify_n
+
+// в режиме S21_FTZ_DAZ результат меньше S21_DBL_MIN заменяется нулём, не
+// округляясь в денормализованное число
+static inline double s21_flush(long double r, int ftz) {
+  return ftz && r < S21_DBL_MIN ? 0 : (double)r;
+}
+
+// SIMD-ядра отдают блоки с денормализованными числами скалярному ядру,
+// которое масштабирует их заранее: sqrtpd обрабатывал бы их микрокодом
+static inline int s21_has_subnormal(const double *x, size_t n) {
+  return (s21_classify_n(x, NULL, n) & S21_FP_BIT(S21_FP_SUBNORMAL)) != 0;
+}
+
+void s21_cbrt_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_cbrt(x[i]);
+}
+
+void s21_erf_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_erf(x[i]);
+}
+
+void s21_erfc_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_erfc(x[i]);
+}
+
+void s21_exp2_n(const double *x, double *res, size_t n) {
+  int ftz = s21_fp_mode_get() == S21_FTZ_DAZ;
+  for (size_t i = 0; i < n; i++) {
+    res[i] = s21_flush(s21_exp2_kernel(x[i]), ftz);
+  }
+}
+
+void s21_exp10_n(const double *x, double *res, size_t n) {
+  int ftz = s21_fp_mode_get() == S21_FTZ_DAZ;
+  for (size_t i = 0; i < n; i++) {
+    res[i] = s21_flush(s21_exp_kernel(x[i] * S21_LN10), ftz);
+  }
+}
+
+void s21_expm1_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_expm1(x[i]);
+}
+
+void s21_lgamma_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_lgamma(x[i]);
+}
+
+void s21_log1p_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_log1p(x[i]);
+}
+
+void s21_log2_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_log2(x[i]);
+}
+
+void s21_log10_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_log10(x[i]);
+}
+
+static void s21_rsqrt_simd_block(const double *x, double *res, size_t n) {
+  size_t i = 0;
+#if defined(__AVX__)
+  for (; i + 4 <= n; i += 4) {
+    __m256d v = _mm256_sqrt_pd(_mm256_loadu_pd(x + i));
+    _mm256_storeu_pd(res + i, _mm256_div_pd(_mm256_set1_pd(1.0), v));
+  }
+#elif defined(__SSE2__)
+  for (; i + 2 <= n; i += 2) {
+    __m128d v = _mm_sqrt_pd(_mm_loadu_pd(x + i));
+    _mm_storeu_pd(res + i, _mm_div_pd(_mm_set1_pd(1.0), v));
+  }
+#endif
+  for (; i < n; i++) res[i] = s21_rsqrt(x[i]);
+}
+
+void s21_rsqrt_simd_n(const double *x, double *res, size_t n) {
+  for (size_t b = 0; b < n; b += S21_CLEAN_BLOCK) {
+    size_t len = n - b < S21_CLEAN_BLOCK ? n - b : S21_CLEAN_BLOCK;
+    if (s21_has_subnormal(x + b, len)) {
+      s21_rsqrt_scalar_n(x + b, res + b, len);
+    } else {
+      s21_rsqrt_simd_block(x + b, res + b, len);
+    }
+  }
+}
+
+void s21_rsqrt_fast_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_rsqrt_fast(x[i]);
+}
+
+static void s21_sqrt_simd_block(const double *x, double *res, size_t n) {
+  size_t i = 0;
+#if defined(__AVX__)
+  for (; i + 4 <= n; i += 4) {
+    _mm256_storeu_pd(res + i, _mm256_sqrt_pd(_mm256_loadu_pd(x + i)));
+  }
+#elif defined(__SSE2__)
+  for (; i + 2 <= n; i += 2) {
+    _mm_storeu_pd(res + i, _mm_sqrt_pd(_mm_loadu_pd(x + i)));
+  }
+#endif
+  for (; i < n; i++) res[i] = s21_sqrt(x[i]);
+}
+
+void s21_sqrt_simd_n(const double *x, double *res, size_t n) {
+  for (size_t b = 0; b < n; b += S21_CLEAN_BLOCK) {
+    size_t len = n - b < S21_CLEAN_BLOCK ? n - b : S21_CLEAN_BLOCK;
+    if (s21_has_subnormal(x + b, len)) {
+      s21_sqrt_scalar_n(x + b, res + b, len);
+    } else {
+      s21_sqrt_simd_block(x + b, res + b, len);
+    }
+  }
+}
+
+void s21_tgamma_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_tgamma(x[i]);
+}
+
+void s21_acos_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_acos(x[i]);
+}
+
+void s21_asin_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_asin(x[i]);
+}
+
+void s21_atan_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_atan(x[i]);
+}
+
+void s21_ceil_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_ceil(x[i]);
+}
+
+void s21_cos_poly_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_cos(x[i]);
+}
+
+void s21_fabs_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_fabs(x[i]);
+}
+
+void s21_floor_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_floor(x[i]);
+}
+
+void s21_log_series_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_log(x[i]);
+}
+
+void s21_sin_poly_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_sin(x[i]);
+}
+
+void s21_tan_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_tan(x[i]);
+}
+
+void s21_exp_table_n(const double *x, double *res, size_t n) {
+  int ftz = s21_fp_mode_get() == S21_FTZ_DAZ;
+  for (size_t i = 0; i < n; i++) {
+    res[i] = s21_flush(s21_exp_kernel(x[i]), ftz);
+  }
+}
+
+static inline double s21_log_table_one(double x) {
+  int e, scale;
+  long double m = s21_log_kernel(s21_prescale(x, &scale), &e);
+  return (e + scale) * S21_LN2 + m;
+}
+
+// блоки только из положительных нормальных чисел идут без проверок
+void s21_log_table_n(const double *x, double *res, size_t n) {
+  for (size_t b = 0; b < n; b += S21_CLEAN_BLOCK) {
+    size_t end = n - b < S21_CLEAN_BLOCK ? n : b + S21_CLEAN_BLOCK;
+    if (s21_classify_n(x + b, NULL, end - b) == S21_FP_BIT(S21_FP_NORMAL)) {
+      for (size_t i = b; i < end; i++) res[i] = s21_log_table_one(x[i]);
+    } else {
+      for (size_t i = b; i < end; i++) {
+        res[i] = x[i] > 0 && x[i] != S21_INF ? s21_log_table_one(x[i])
+                                             : (double)s21_log(x[i]);
+      }
+    }
+  }
+}
+
+// sin(x) = sin(pi * (x / pi)): приведение точное, но x / pi округляется,
+// поэтому абсолютная погрешность растёт с |x|. От 2^52 pi частное целое и
+// sinpi даёт 0, такие x, а также inf и NaN считаются s21_sin/s21_cos
+#define S21_SINPI_MAX (0x1p52 * S21_PI_L)
+
+void s21_sin_sinpi_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    res[i] = s21_fabs(x[i]) < S21_SINPI_MAX ? s21_sinpi_kernel(x[i] / S21_PI_L)
+                                            : s21_sin(x[i]);
+  }
+}
+
+void s21_cos_sinpi_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    res[i] = s21_fabs(x[i]) < S21_SINPI_MAX
+                 ? s21_sinpi_kernel(x[i] / S21_PI_L + 0.5L)
+                 : s21_cos(x[i]);
+  }
+}
+
+void s21_sqrt_scalar_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_sqrt(x[i]);
+}
+
+void s21_rsqrt_scalar_n(const double *x, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_rsqrt(x[i]);
+}
+
+// Функции с несколькими реализациями вызывают ядро, выбранное s21_tune
+void s21_cos_n(const double *x, double *res, size_t n) {
+  s21_tuned_kernel(S21_TUNE_COS)(x, res, n);
+}
+
+void s21_exp_n(const double *x, double *res, size_t n) {
+  s21_tuned_kernel(S21_TUNE_EXP)(x, res, n);
+}
+
+void s21_log_n(const double *x, double *res, size_t n) {
+  s21_tuned_kernel(S21_TUNE_LOG)(x, res, n);
+}
+
+void s21_rsqrt_n(const double *x, double *res, size_t n) {
+  s21_tuned_kernel(S21_TUNE_RSQRT)(x, res, n);
+}
+
+void s21_sin_n(const double *x, double *res, size_t n) {
+  s21_tuned_kernel(S21_TUNE_SIN)(x, res, n);
+}
+
+void s21_sqrt_n(const double *x, double *res, size_t n) {
+  s21_tuned_kernel(S21_TUNE_SQRT)(x, res, n);
+}
+
+void s21_fmod_n(const double *x, const double *y, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_fmod(x[i], y[i]);
+}
+
+void s21_pow_n(const double *base, const double *exp, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_pow(base[i], exp[i]);
+}
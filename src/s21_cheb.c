@@ -0,0 +1,279 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "s21_math.h"
+#include "utils.h"
+
+// Отрезок [a, b] делится на 1, 2, 4, ... равных частей, пока интерполянт
+// по узлам Чебышёва на каждой части не уложится в допуск. Степень общая
+// для всех частей: наименьшая, при которой отброшенный хвост ряда Чебышёва
+// не превышает половины допуска. Для вычисления ряд переводится в
+// коэффициенты многочлена от t = (x - центр) / полуширина и считается
+// схемой Горнера через s21_polyval, пакетно — s21_polyval_n по подряд
+// идущим точкам одной части. Погрешность измеряется уже с округлением
+// этих коэффициентов до double; сохраняются сами коэффициенты Чебышёва,
+// они ограничены по модулю значениями функции.
+
+#define S21_CHEB_MAX_DEGREE 16
+#define S21_CHEB_MAX_SEGMENTS 4096
+#define S21_CHEB_PROBES 8  // точек проверки на узел
+#define S21_CHEB_MAGIC "S21C"
+#define S21_CHEB_VERSION 1
+#define S21_CHEB_HEADER 48
+#define S21_CHEB_BLOCK 256  // точек на один проход s21_cheb_eval_n
+#define S21_CHEB_NAN SIZE_MAX
+
+struct s21_cheb {
+  double a, b;
+  double inv_w;  // segments / (b - a)
+  size_t segments;
+  int degree;
+  double max_error;
+  double *cheb;       // коэффициенты Чебышёва, degree + 1 на часть
+  double *poly;       // те же многочлены по степеням t
+};
+
+// T_0 .. T_d с весами c[j] как многочлен по степеням t
+static void s21_cheb_to_poly(const double *c, int d, double *res) {
+  long double prev[S21_CHEB_MAX_DEGREE + 1] = {1};
+  long double cur[S21_CHEB_MAX_DEGREE + 1] = {0, 1};
+  long double p[S21_CHEB_MAX_DEGREE + 1];
+  for (int i = 0; i <= d; i++) p[i] = 0;
+  p[0] = c[0];
+  if (d > 0) p[1] = c[1];
+  for (int j = 2; j <= d; j++) {
+    long double next[S21_CHEB_MAX_DEGREE + 1];
+    next[0] = -prev[0];
+    for (int i = 1; i <= j; i++) {
+      next[i] = 2 * cur[i - 1] - (i <= j - 2 ? prev[i] : 0);
+    }
+    for (int i = 0; i <= j; i++) {
+      p[i] += c[j] * next[i];
+      prev[i] = cur[i];
+      cur[i] = next[i];
+    }
+  }
+  for (int i = 0; i <= d; i++) res[i] = (double)p[i];
+}
+
+static s21_cheb *s21_cheb_alloc(size_t segments, int degree) {
+  s21_cheb *c = malloc(sizeof(*c));
+  size_t count = segments * (size_t)(degree + 1);
+  if (c != NULL) {
+    c->cheb = malloc(count * sizeof(*c->cheb));
+    c->poly = malloc(count * sizeof(*c->poly));
+    if (c->cheb == NULL || c->poly == NULL) {
+      s21_cheb_free(c);
+      c = NULL;
+    }
+  }
+  if (c != NULL) {
+    c->segments = segments;
+    c->degree = degree;
+  }
+  return c;
+}
+
+static void s21_cheb_finish(s21_cheb *c, double a, double b) {
+  c->a = a;
+  c->b = b;
+  c->inv_w = c->segments / (b - a);
+  size_t stride = (size_t)c->degree + 1;
+  for (size_t s = 0; s < c->segments; s++) {
+    s21_cheb_to_poly(c->cheb + s * stride, c->degree, c->poly + s * stride);
+  }
+}
+
+// коэффициенты всех частей при степени S21_CHEB_MAX_DEGREE; возвращает
+// степень, достаточную для допуска tol
+static int s21_cheb_fit(long double (*f)(double), double a, double b,
+                        size_t segments, int max_degree, double tol,
+                        double *coef) {
+  int n = S21_CHEB_MAX_DEGREE + 1;
+  // cosv[j][k] = cos(j * theta_k), theta_k = pi (k + 1/2) / n
+  long double cosv[S21_CHEB_MAX_DEGREE + 1][S21_CHEB_MAX_DEGREE + 1];
+  double fv[S21_CHEB_MAX_DEGREE + 1];
+  for (int j = 0; j < n; j++) {
+    for (int k = 0; k < n; k++) {
+      cosv[j][k] = s21_sinpi_kernel(j * (k + 0.5L) / n + 0.5L);
+    }
+  }
+  long double w = ((long double)b - a) / segments;
+  int need = 0;
+  for (size_t s = 0; s < segments; s++) {
+    long double center = a + (s + 0.5L) * w;
+    double *c = coef + s * n;
+    for (int k = 0; k < n; k++) fv[k] = f(center + w / 2 * cosv[1][k]);
+    for (int j = 0; j < n; j++) {
+      long double sum = 0;
+      for (int k = 0; k < n; k++) sum += fv[k] * cosv[j][k];
+      c[j] = (j == 0 ? 1.0L : 2.0L) * sum / n;
+    }
+    int m = max_degree;
+    long double tail = 0;
+    for (int j = n - 1; j > max_degree; j--) tail += s21_fabs(c[j]);
+    while (m > 0 && tail + s21_fabs(c[m]) <= tol / 2) tail += s21_fabs(c[m--]);
+    if (m > need) need = m;
+  }
+  return need;
+}
+
+static double s21_cheb_measure(const s21_cheb *c, long double (*f)(double)) {
+  double err = 0;
+  size_t probes = c->segments * (size_t)(c->degree + 1) * S21_CHEB_PROBES;
+  long double h = ((long double)c->b - c->a) / probes;
+  for (size_t i = 0; i <= probes; i++) {
+    double x = i == probes ? c->b : (double)(c->a + i * h);
+    double e = s21_fabs(s21_cheb_eval(c, x) - f(x));
+    if (e > err || e != e) err = e;
+  }
+  return err;
+}
+
+s21_cheb *s21_cheb_create(long double (*f)(double), double a, double b,
+                          double tol, int max_degree) {
+  s21_cheb *best = NULL;
+  int done = !(f != NULL && a < b && tol > 0 && max_degree >= 1 &&
+               max_degree <= S21_CHEB_MAX_DEGREE);
+  for (size_t segments = 1; !done; segments *= 2) {
+    int n = S21_CHEB_MAX_DEGREE + 1;
+    double *coef = malloc(segments * n * sizeof(*coef));
+    s21_cheb *c = NULL;
+    if (coef != NULL) {
+      int degree = s21_cheb_fit(f, a, b, segments, max_degree, tol, coef);
+      c = s21_cheb_alloc(segments, degree);
+      if (c != NULL) {
+        for (size_t s = 0; s < segments; s++) {
+          memcpy(c->cheb + s * (degree + 1), coef + s * n,
+                 (degree + 1) * sizeof(*coef));
+        }
+        s21_cheb_finish(c, a, b);
+        c->max_error = s21_cheb_measure(c, f);
+      }
+      free(coef);
+    }
+    if (c == NULL) {
+      done = 1;
+    } else {
+      if (best == NULL || !(best->max_error <= c->max_error)) {
+        s21_cheb_free(best);
+        best = c;
+      } else {
+        s21_cheb_free(c);
+      }
+      done = best->max_error <= tol || segments >= S21_CHEB_MAX_SEGMENTS;
+    }
+  }
+  return best;
+}
+
+void s21_cheb_free(s21_cheb *c) {
+  if (c != NULL) {
+    free(c->cheb);
+    free(c->poly);
+    free(c);
+  }
+}
+
+// номер части для x и t в [-1, 1] внутри неё
+static size_t s21_cheb_locate(const s21_cheb *c, double x, double *t) {
+  double u = (x - c->a) * c->inv_w;
+  if (!(u > 0)) u = 0;
+  if (u > c->segments) u = (double)c->segments;
+  size_t s = (size_t)u;
+  if (s >= c->segments) s = c->segments - 1;
+  *t = 2 * (u - s) - 1;
+  return s;
+}
+
+double s21_cheb_eval(const s21_cheb *c, double x) {
+  double t, res = x;  // NaN не прижимается к краю отрезка
+  if (x == x) {
+    size_t s = s21_cheb_locate(c, x, &t);
+    res = s21_polyval(c->poly + s * (c->degree + 1), c->degree, t,
+                      S21_POLY_HORNER);
+  }
+  return res;
+}
+
+void s21_cheb_eval_n(const s21_cheb *c, const double *x, double *res,
+                     size_t n) {
+  size_t stride = (size_t)c->degree + 1;
+  size_t seg[S21_CHEB_BLOCK];
+  double t[S21_CHEB_BLOCK];
+  for (size_t b = 0; b < n; b += S21_CHEB_BLOCK) {
+    size_t len = n - b < S21_CHEB_BLOCK ? n - b : S21_CHEB_BLOCK;
+    // NaN получает часть S21_CHEB_NAN и сам остаётся в t
+    for (size_t i = 0; i < len; i++) {
+      double v = x[b + i];
+      t[i] = v;
+      seg[i] = v == v ? s21_cheb_locate(c, v, t + i) : S21_CHEB_NAN;
+    }
+    for (size_t i = 0, j; i < len; i = j) {
+      for (j = i + 1; j < len && seg[j] == seg[i]; j++) {
+      }
+      if (seg[i] == S21_CHEB_NAN) {
+        for (size_t k = i; k < j; k++) res[b + k] = t[k];
+      } else {
+        s21_polyval_n(c->poly + seg[i] * stride, c->degree, t + i,
+                      res + b + i, j - i, S21_POLY_HORNER);
+      }
+    }
+  }
+}
+
+double s21_cheb_max_error(const s21_cheb *c) { return c->max_error; }
+
+int s21_cheb_degree(const s21_cheb *c) { return c->degree; }
+
+size_t s21_cheb_segments(const s21_cheb *c) { return c->segments; }
+
+size_t s21_cheb_memory(const s21_cheb *c) {
+  size_t count = c->segments * (size_t)(c->degree + 1);
+  return sizeof(*c) + count * (sizeof(*c->cheb) + sizeof(*c->poly));
+}
+
+// Формат: "S21C", версия, степень, 0 (uint32), число частей (uint64), a, b,
+// погрешность и коэффициенты Чебышёва (double), порядок байтов машины
+size_t s21_cheb_save(const s21_cheb *c, void *buf, size_t size) {
+  size_t count = c->segments * (size_t)(c->degree + 1);
+  size_t need = S21_CHEB_HEADER + count * sizeof(double);
+  if (buf != NULL && size >= need) {
+    unsigned char *p = buf;
+    uint32_t head[3] = {S21_CHEB_VERSION, (uint32_t)c->degree, 0};
+    uint64_t segments = c->segments;
+    double v[3] = {c->a, c->b, c->max_error};
+    memcpy(p, S21_CHEB_MAGIC, 4);
+    memcpy(p + 4, head, sizeof(head));
+    memcpy(p + 16, &segments, sizeof(segments));
+    memcpy(p + 24, v, sizeof(v));
+    memcpy(p + S21_CHEB_HEADER, c->cheb, count * sizeof(double));
+  }
+  return need;
+}
+
+s21_cheb *s21_cheb_load(const void *buf, size_t size) {
+  s21_cheb *c = NULL;
+  const unsigned char *p = buf;
+  uint32_t head[3] = {0, 0, 0};
+  uint64_t segments = 0;
+  double v[3] = {0, 0, 0};
+  if (buf != NULL && size >= S21_CHEB_HEADER &&
+      memcmp(p, S21_CHEB_MAGIC, 4) == 0) {
+    memcpy(head, p + 4, sizeof(head));
+    memcpy(&segments, p + 16, sizeof(segments));
+    memcpy(v, p + 24, sizeof(v));
+  }
+  if (head[0] == S21_CHEB_VERSION && head[1] <= S21_CHEB_MAX_DEGREE &&
+      segments >= 1 && segments <= S21_CHEB_MAX_SEGMENTS && v[0] < v[1] &&
+      size >= S21_CHEB_HEADER + segments * (head[1] + 1) * sizeof(double)) {
+    c = s21_cheb_alloc((size_t)segments, (int)head[1]);
+  }
+  if (c != NULL) {
+    memcpy(c->cheb, p + S21_CHEB_HEADER,
+           c->segments * (c->degree + 1) * sizeof(double));
+    c->max_error = v[2];
+    s21_cheb_finish(c, v[0], v[1]);
+  }
+  return c;
+}
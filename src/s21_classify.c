@@ -0,0 +1,177 @@
+#include "s21_math.h"
+#include "utils.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Классы определяются по битам порядка, без сравнений с плавающей точкой,
+// поэтому не зависят от режимов FTZ/DAZ. Векторный путь проверяет сразу
+// S21_VL элементов: если ни у одного порядок не равен 0 или 0x7ff, все они
+// нормальные, и поэлементная проверка не нужна.
+
+#define S21_EXP_MASK 0x7ff0000000000000ULL
+#define S21_MANT_MASK 0x000fffffffffffffULL
+
+#if defined(__AVX2__)
+typedef __m256d s21_vd;
+#define S21_VL 4
+#define s21_vload _mm256_loadu_pd
+#define s21_vstore _mm256_storeu_pd
+#define s21_vset1 _mm256_set1_pd
+#define s21_vclamp(v, lo, hi) _mm256_min_pd(_mm256_max_pd(v, lo), hi)
+#define s21_vneq(a, b) \
+  ((unsigned)_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_NEQ_UQ)))
+#elif defined(__SSE2__)
+typedef __m128d s21_vd;
+#define S21_VL 2
+#define s21_vload _mm_loadu_pd
+#define s21_vstore _mm_storeu_pd
+#define s21_vset1 _mm_set1_pd
+#define s21_vclamp(v, lo, hi) _mm_min_pd(_mm_max_pd(v, lo), hi)
+#define s21_vneq(a, b) ((unsigned)_mm_movemask_pd(_mm_cmpneq_pd(a, b)))
+#endif
+
+#if defined(S21_VL)
+// биты элементов с порядком 0 или 0x7ff (want_zero = 0 — только 0x7ff)
+static inline unsigned s21_special_lanes(const double *p, int want_zero) {
+#if defined(__AVX2__)
+  __m256i e = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)p),
+                               _mm256_set1_epi64x((int64_t)S21_EXP_MASK));
+  __m256i hit = _mm256_cmpeq_epi64(e, _mm256_set1_epi64x(S21_EXP_MASK));
+  if (want_zero) {
+    __m256i zero = _mm256_cmpeq_epi64(e, _mm256_setzero_si256());
+    hit = _mm256_or_si256(hit, zero);
+  }
+  return (unsigned)_mm256_movemask_pd(_mm256_castsi256_pd(hit));
+#else
+  // после маски младшие 32 бита нулевые, достаточно сравнить старшие
+  __m128i e = _mm_and_si128(_mm_loadu_si128((const __m128i *)p),
+                            _mm_set1_epi64x((int64_t)S21_EXP_MASK));
+  __m128i hit = _mm_cmpeq_epi32(e, _mm_set1_epi64x(S21_EXP_MASK));
+  if (want_zero) {
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi32(e, _mm_setzero_si128()));
+  }
+  return (unsigned)_mm_movemask_pd(_mm_castsi128_pd(hit));
+#endif
+}
+
+static inline unsigned s21_sign_lanes(const double *p) {
+#if defined(__AVX2__)
+  return (unsigned)_mm256_movemask_pd(_mm256_loadu_pd(p));
+#else
+  return (unsigned)_mm_movemask_pd(_mm_loadu_pd(p));
+#endif
+}
+
+static inline size_t s21_popcount(unsigned m) {
+  size_t count = 0;
+  for (; m; m &= m - 1) count++;
+  return count;
+}
+#endif
+
+s21_fp_class s21_classify(double x) {
+  uint64_t bits = s21_double_bits(x);
+  uint64_t e = bits & S21_EXP_MASK, m = bits & S21_MANT_MASK;
+  s21_fp_class c = S21_FP_NORMAL;
+  if (e == S21_EXP_MASK) {
+    c = m ? S21_FP_NAN : S21_FP_INFINITE;
+  } else if (e == 0) {
+    c = m ? S21_FP_SUBNORMAL : S21_FP_ZERO;
+  }
+  return c;
+}
+
+static unsigned s21_classify_one(double x, unsigned char *cls) {
+  s21_fp_class c = s21_classify(x);
+  if (cls != NULL) *cls = (unsigned char)c;
+  return S21_FP_BIT(c) | (s21_double_bits(x) >> 63 ? S21_FP_NEGATIVE : 0);
+}
+
+unsigned s21_classify_n(const double *x, unsigned char *cls, size_t n) {
+  unsigned mask = 0;
+  size_t i = 0;
+#if defined(S21_VL)
+  for (; i + S21_VL <= n; i += S21_VL) {
+    if (s21_special_lanes(x + i, 1) == 0) {
+      mask |= S21_FP_BIT(S21_FP_NORMAL);
+      if (s21_sign_lanes(x + i)) mask |= S21_FP_NEGATIVE;
+      for (int k = 0; cls != NULL && k < S21_VL; k++) {
+        cls[i + k] = S21_FP_NORMAL;
+      }
+    } else {
+      for (int k = 0; k < S21_VL; k++) {
+        mask |= s21_classify_one(x[i + k], cls ? cls + i + k : NULL);
+      }
+    }
+  }
+#endif
+  for (; i < n; i++) mask |= s21_classify_one(x[i], cls ? cls + i : NULL);
+  return mask;
+}
+
+size_t s21_count_nonfinite_n(const double *x, size_t n) {
+  size_t count = 0;
+  size_t i = 0;
+#if defined(S21_VL)
+  for (; i + S21_VL <= n; i += S21_VL) {
+    count += s21_popcount(s21_special_lanes(x + i, 0));
+  }
+#endif
+  for (; i < n; i++) {
+    count += (s21_double_bits(x[i]) & S21_EXP_MASK) == S21_EXP_MASK;
+  }
+  return count;
+}
+
+static double s21_sanitize_one(double x, const s21_sanitize_opts *opts) {
+  s21_fp_class c = s21_classify(x);
+  double v = x;
+  if (opts->replace & S21_FP_BIT(c)) {
+    if (c == S21_FP_NAN) {
+      v = opts->nan;
+    } else if (c == S21_FP_INFINITE) {
+      v = x > 0 ? opts->pos_inf : opts->neg_inf;
+    } else if (c == S21_FP_SUBNORMAL) {
+      v = opts->subnormal;
+    }
+  }
+  if (v < opts->lo) v = opts->lo;
+  if (v > opts->hi) v = opts->hi;
+  return v;
+}
+
+// 1, если значение изменилось (с точностью до битов)
+static size_t s21_sanitize_at(const double *x, double *res, size_t i,
+                              const s21_sanitize_opts *opts) {
+  double v = x[i], r = s21_sanitize_one(v, opts);
+  res[i] = r;
+  return s21_double_bits(v) != s21_double_bits(r);
+}
+
+// в блоке без особых значений остаётся только прижатие к [lo, hi]
+size_t s21_sanitize_n(const double *x, double *res, size_t n,
+                      const s21_sanitize_opts *opts) {
+  size_t changed = 0;
+  size_t i = 0;
+#if defined(S21_VL)
+  s21_vd lo = s21_vset1(opts->lo), hi = s21_vset1(opts->hi);
+  for (; i + S21_VL <= n; i += S21_VL) {
+    if (s21_special_lanes(x + i, 1) == 0) {
+      s21_vd v = s21_vload(x + i);
+      s21_vd r = s21_vclamp(v, lo, hi);
+      changed += s21_popcount(s21_vneq(v, r));
+      s21_vstore(res + i, r);
+    } else {
+      for (int k = 0; k < S21_VL; k++) {
+        changed += s21_sanitize_at(x, res, i + k, opts);
+      }
+    }
+  }
+#endif
+  for (; i < n; i++) changed += s21_sanitize_at(x, res, i, opts);
+  return changed;
+}
@@ -0,0 +1,205 @@
+#include <complex.h>
+
+#include "s21_math.h"
+#include "utils.h"
+
+// Комплексные функции. Ядра принимают действительную и мнимую части
+// отдельно и считают в long double; скалярные версии распаковывают
+// double complex, пакетные работают прямо с раздельными массивами re/im.
+// sin и cos мнимой (для cexp) или действительной (для csin, ccos) части
+// получаются из одного приведения аргумента.
+
+static void s21_cexp_core(long double x, long double y, long double *re,
+                          long double *im) {
+  if (y == 0) {
+    *re = s21_exp_kernel(x);
+    *im = y;
+  } else if (y != y || S21_IS_INF(y)) {
+    *re = x == S21_INF_NEG ? 0 : x == S21_INF ? x : S21_NAN;
+    *im = x == S21_INF_NEG ? 0 : S21_NAN;
+  } else {
+    long double s, c;
+    s21_sincos_kernel(y, &s, &c);
+    if (x > 700) {
+      // e^x за пределами double, а e^x cos y ещё может в него попасть
+      long double h = s21_exp_kernel(x / 2);
+      *re = h * c * h;
+      *im = h * s * h;
+    } else {
+      long double e = s21_exp_kernel(x);
+      *re = e * c;
+      *im = e * s;
+    }
+  }
+}
+
+// x^2 + y^2 - 1 без потери точности при сокращении: x и y делятся на
+// старшие и младшие 26 бит, все произведения точны в long double
+static long double s21_norm_m1(double x, double y) {
+  double cx = 134217729.0 * x, cy = 134217729.0 * y;
+  double xh = cx - (cx - x), yh = cy - (cy - y);
+  long double xl = x - xh, yl = y - yh;
+  return (((long double)xh * xh - 1) + (long double)yh * yh) +
+         2 * (xh * xl + yh * yl) + (xl * xl + yl * yl);
+}
+
+static void s21_clog_core(double x, double y, long double *re,
+                          long double *im) {
+  long double h = s21_hypot_kernel(x, y);
+  if (h > 0.5L && h < 2) {
+    // вблизи |z| = 1 логарифм мал, считается через log1p(|z|^2 - 1)
+    *re = s21_log1p_kernel(s21_norm_m1(x, y)) / 2;
+  } else {
+    *re = s21_log_scaled(h, S21_LN2, 1);
+  }
+  *im = s21_atan2_kernel(y, x);
+}
+
+static void s21_cpow_core(double x, double y, double u, double v,
+                          long double *re, long double *im) {
+  if (x == 0 && y == 0 && u == 0 && v == 0) {
+    *re = 1;
+    *im = 0;
+  } else if (x == 0 && y == 0 && u > 0 && v == 0) {
+    *re = *im = 0;
+  } else {
+    long double lr, li;
+    s21_clog_core(x, y, &lr, &li);
+    s21_cexp_core(u * lr - v * li, u * li + v * lr, re, im);
+  }
+}
+
+static void s21_csqrt_core(double x, double y, long double *re,
+                           long double *im) {
+  int neg_y = (int)(s21_double_bits(y) >> 63);
+  if (S21_IS_INF(y)) {
+    *re = S21_INF;
+    *im = y;
+  } else if (x != x || y != y) {
+    *re = *im = S21_NAN;
+  } else if (x == S21_INF_NEG) {
+    *re = 0;
+    *im = neg_y ? S21_INF_NEG : S21_INF;
+  } else if (x == S21_INF) {
+    *re = x;
+    *im = neg_y ? -0.0 : 0.0;
+  } else if (x == 0 && y == 0) {
+    *re = 0;
+    *im = y;
+  } else {
+    long double h = s21_hypot_kernel(x, y);
+    long double t = s21_sqrtl(s21_fabs(x) / 2 + h / 2);
+    if (x >= 0) {
+      *re = t;
+      *im = y / (2 * t);
+    } else {
+      *re = (neg_y ? -y : y) / (2 * t);
+      *im = neg_y ? -t : t;
+    }
+  }
+}
+
+// cosh y и sinh y; при |y| < 1 через expm1, чтобы не терять sinh
+static void s21_coshsinh(double y, long double *ch, long double *sh) {
+  int neg = (int)(s21_double_bits(y) >> 63);
+  long double a = neg ? -(long double)y : y;  // для -0 тоже +0
+  if (a < 1) {
+    long double em = s21_expm1_kernel(a);
+    *sh = (em + em / (em + 1)) / 2;
+    *ch = 1 + em * em / (2 * (em + 1));
+  } else if (a < 700) {
+    long double e = s21_exp_kernel(a);
+    *sh = (e - 1 / e) / 2;
+    *ch = (e + 1 / e) / 2;
+  } else {
+    long double h = s21_exp_kernel(a / 2);
+    *sh = *ch = h / 2 * h;
+  }
+  if (neg) *sh = -*sh;
+}
+
+// sin(x + iy) = sin x cosh y + i cos x sinh y
+static void s21_csin_core(double x, double y, long double *re,
+                          long double *im) {
+  long double s, c, ch, sh;
+  s21_coshsinh(y, &ch, &sh);
+  if (x == 0) {
+    *re = x;
+    *im = sh;
+  } else {
+    s21_sincos_kernel(x, &s, &c);
+    *re = s * ch;
+    *im = c * sh;
+  }
+}
+
+// cos(x + iy) = cos x cosh y - i sin x sinh y
+static void s21_ccos_core(double x, double y, long double *re,
+                          long double *im) {
+  long double s, c, ch, sh;
+  s21_coshsinh(y, &ch, &sh);
+  if (x == 0) {
+    *re = ch;
+    *im = (s21_double_bits(x) ^ s21_double_bits(y)) >> 63 ? 0.0 : -0.0;
+  } else {
+    s21_sincos_kernel(x, &s, &c);
+    *re = c * ch;
+    *im = -(s * sh);
+  }
+}
+
+long double s21_cabs(double complex z) {
+  return s21_hypot_kernel(creal(z), cimag(z));
+}
+
+long double s21_carg(double complex z) {
+  return s21_atan2_kernel(cimag(z), creal(z));
+}
+
+#define S21_COMPLEX_UNARY(name)                                            \
+  double complex s21_##name(double complex z) {                            \
+    long double re, im;                                                    \
+    s21_##name##_core(creal(z), cimag(z), &re, &im);                       \
+    return CMPLX((double)re, (double)im);                                  \
+  }                                                                        \
+                                                                           \
+  void s21_##name##_n(const double *re, const double *im, double *res_re, \
+                      double *res_im, size_t n) {                          \
+    for (size_t i = 0; i < n; i++) {                                       \
+      long double r, v;                                                    \
+      s21_##name##_core(re[i], im[i], &r, &v);                             \
+      res_re[i] = (double)r;                                               \
+      res_im[i] = (double)v;                                               \
+    }                                                                      \
+  }
+
+S21_COMPLEX_UNARY(cexp)
+S21_COMPLEX_UNARY(clog)
+S21_COMPLEX_UNARY(csqrt)
+S21_COMPLEX_UNARY(csin)
+S21_COMPLEX_UNARY(ccos)
+
+double complex s21_cpow(double complex z, double complex w) {
+  long double re, im;
+  s21_cpow_core(creal(z), cimag(z), creal(w), cimag(w), &re, &im);
+  return CMPLX((double)re, (double)im);
+}
+
+void s21_cpow_n(const double *re, const double *im, const double *w_re,
+                const double *w_im, double *res_re, double *res_im,
+                size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    long double r, v;
+    s21_cpow_core(re[i], im[i], w_re[i], w_im[i], &r, &v);
+    res_re[i] = (double)r;
+    res_im[i] = (double)v;
+  }
+}
+
+void s21_cabs_n(const double *re, const double *im, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_hypot_kernel(re[i], im[i]);
+}
+
+void s21_carg_n(const double *re, const double *im, double *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_atan2_kernel(im[i], re[i]);
+}
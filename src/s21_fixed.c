@@ -0,0 +1,177 @@
+#include <stdint.h>
+
+#include "s21_math.h"
+
+// sin(i * pi / 512) в Q1.15, i = 0..256 (четверть периода)
+static const int16_t s21_sin_q15_table[257] = {
+    0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809, 2009, 2210, 2411, 2611,
+    2811, 3012, 3212, 3412, 3612, 3812, 4011, 4211, 4410, 4609, 4808, 5007,
+    5205, 5404, 5602, 5800, 5998, 6195, 6393, 6590, 6787, 6983, 7180, 7376,
+    7571, 7767, 7962, 8157, 8351, 8546, 8740, 8933, 9127, 9319, 9512, 9704,
+    9896, 10088, 10279, 10469, 10660, 10850, 11039, 11228, 11417, 11605, 11793,
+    11980, 12167, 12354, 12540, 12725, 12910, 13095, 13279, 13463, 13646, 13828,
+    14010, 14192, 14373, 14553, 14733, 14912, 15091, 15269, 15447, 15624, 15800,
+    15976, 16151, 16326, 16500, 16673, 16846, 17018, 17190, 17361, 17531, 17700,
+    17869, 18037, 18205, 18372, 18538, 18703, 18868, 19032, 19195, 19358, 19520,
+    19681, 19841, 20001, 20160, 20318, 20475, 20632, 20788, 20943, 21097, 21251,
+    21403, 21555, 21706, 21856, 22006, 22154, 22302, 22449, 22595, 22740, 22884,
+    23028, 23170, 23312, 23453, 23593, 23732, 23870, 24008, 24144, 24279, 24414,
+    24548, 24680, 24812, 24943, 25073, 25202, 25330, 25457, 25583, 25708, 25833,
+    25956, 26078, 26199, 26320, 26439, 26557, 26674, 26791, 26906, 27020, 27133,
+    27246, 27357, 27467, 27576, 27684, 27791, 27897, 28002, 28106, 28209, 28311,
+    28411, 28511, 28610, 28707, 28803, 28899, 28993, 29086, 29178, 29269, 29359,
+    29448, 29535, 29622, 29707, 29792, 29875, 29957, 30038, 30118, 30196, 30274,
+    30350, 30425, 30499, 30572, 30644, 30715, 30784, 30853, 30920, 30986, 31050,
+    31114, 31177, 31238, 31298, 31357, 31415, 31471, 31527, 31581, 31634, 31686,
+    31737, 31786, 31834, 31881, 31927, 31972, 32015, 32058, 32099, 32138, 32177,
+    32214, 32251, 32286, 32319, 32352, 32383, 32413, 32442, 32470, 32496, 32522,
+    32546, 32568, 32590, 32610, 32629, 32647, 32664, 32679, 32693, 32706, 32718,
+    32729, 32738, 32746, 32753, 32758, 32762, 32766, 32767, 32767};
+
+// atan(2^-i) для CORDIC, единицы: pi = 2^23
+static const int32_t s21_atan_cordic[16] = {
+    2097152, 1238021, 654136, 332050, 166669, 83416, 41718, 20860,
+    10430,   5215,    2608,   1304,   652,    326,   163,   81};
+
+// 1 / i! в Q30
+static const int64_t s21_exp_q30_coef[10] = {
+    1073741824, 1073741824, 536870912, 178956971, 44739243,
+    8947849,    1491308,    213044,    26631,     2959};
+
+#define S21_LN2_Q32 2977044472LL
+#define S21_LOG2E_Q16 94548
+#define S21_EXP_Q16_MAX 681391    // ln(32768) в Q16.16
+#define S21_EXP_Q16_MIN (-772243)  // ln(2^-17) в Q16.16
+
+// sin на [0, pi/2]; p — позиция в четверти, 14 бит
+static int32_t s21_sin_quarter(uint32_t p) {
+  uint32_t i = p >> 6;
+  int32_t res = s21_sin_q15_table[i];
+  if (i < 256) {
+    int32_t diff = s21_sin_q15_table[i + 1] - res;
+    res += (diff * (int32_t)(p & 63) + 32) >> 6;
+  }
+  return res;
+}
+
+// a — угол в двоичных единицах, полный оборот = 65536
+static int16_t s21_sin_bam(uint16_t a) {
+  uint32_t p = a & 0x3fff;
+  int32_t res;
+  switch (a >> 14) {
+    case 0:
+      res = s21_sin_quarter(p);
+      break;
+    case 1:
+      res = s21_sin_quarter(16384 - p);
+      break;
+    case 2:
+      res = -s21_sin_quarter(p);
+      break;
+    default:
+      res = -s21_sin_quarter(16384 - p);
+      break;
+  }
+  return (int16_t)res;
+}
+
+int16_t s21_sin_q15(int16_t x) { return s21_sin_bam((uint16_t)x); }
+
+int16_t s21_cos_q15(int16_t x) {
+  return s21_sin_bam((uint16_t)((uint16_t)x + 16384));
+}
+
+int16_t s21_atan2_q15(int16_t y, int16_t x) {
+  int32_t res = 0;
+  if (x != 0 || y != 0) {
+    int32_t cx = (int32_t)x * 16384;
+    int32_t cy = (int32_t)y * 16384;
+    int32_t z = 0;
+    // приводим вектор в правую полуплоскость поворотом на pi/2
+    if (cx < 0) {
+      int32_t t = cx;
+      if (cy >= 0) {
+        cx = cy;
+        cy = -t;
+        z = 1 << 22;
+      } else {
+        cx = -cy;
+        cy = t;
+        z = -(1 << 22);
+      }
+    }
+    for (int i = 0; i < 16; i++) {
+      int32_t dx = cy >> i;
+      int32_t dy = cx >> i;
+      if (cy > 0) {
+        cx += dx;
+        cy -= dy;
+        z += s21_atan_cordic[i];
+      } else {
+        cx -= dx;
+        cy += dy;
+        z -= s21_atan_cordic[i];
+      }
+    }
+    res = (z + 128) >> 8;
+    if (res > 32767) res = 32767;
+  }
+  return (int16_t)res;
+}
+
+int32_t s21_exp_q16(int32_t x) {
+  int32_t res;
+  if (x > S21_EXP_Q16_MAX) {
+    res = INT32_MAX;
+  } else if (x < S21_EXP_Q16_MIN) {
+    res = 0;
+  } else {
+    // x = k * ln2 + r, e^r считаем многочленом в Q30
+    int32_t k = (int32_t)(((int64_t)x * S21_LOG2E_Q16) >> 32);
+    int64_t r = ((int64_t)x * 65536 - k * S21_LN2_Q32) / 4;
+    int64_t acc = s21_exp_q30_coef[9];
+    for (int i = 8; i >= 0; i--) {
+      acc = ((acc * r) >> 30) + s21_exp_q30_coef[i];
+    }
+    int shift = 14 - k;
+    if (shift > 0) acc = (acc + (1LL << (shift - 1))) >> shift;
+    res = acc > INT32_MAX ? INT32_MAX : (int32_t)acc;
+  }
+  return res;
+}
+
+int32_t s21_sqrt_q16(int32_t x) {
+  uint64_t v = (uint64_t)(x < 0 ? 0 : x) << 16;
+  uint64_t res = 0;
+  for (uint64_t bit = 1ULL << 46; bit != 0; bit >>= 2) {
+    if (v >= res + bit) {
+      v -= res + bit;
+      res = (res >> 1) + bit;
+    } else {
+      res >>= 1;
+    }
+  }
+  if (v > res) res++;
+  return (int32_t)res;
+}
+
+void s21_sin_q15_n(const int16_t *x, int16_t *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_sin_q15(x[i]);
+}
+
+void s21_cos_q15_n(const int16_t *x, int16_t *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_cos_q15(x[i]);
+}
+
+void s21_atan2_q15_n(const int16_t *y, const int16_t *x, int16_t *res,
+                     size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_atan2_q15(y[i], x[i]);
+}
+
+void s21_exp_q16_n(const int32_t *x, int32_t *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_exp_q16(x[i]);
+}
+
+void s21_sqrt_q16_n(const int32_t *x, int32_t *res, size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_sqrt_q16(x[i]);
+}
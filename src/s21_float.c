@@ -0,0 +1,244 @@
+#include "s21_math.h"
+#include "utils.h"
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+// Версии для float. Аргумент расширяется до double, вычисления идут в double
+// с многочленами длины, достаточной для точности float (относительный
+// остаток ряда не больше 1e-9), результат округляется до float один раз.
+// Константы — double, чтобы выражения не уходили в long double.
+
+#define S21_F_LN2 0.6931471805599453
+#define S21_F_LOG2E 1.4426950408889634
+#define S21_F_LOG10E 0.4342944819032518
+#define S21_F_LOG10_2 0.30102999566398120
+#define S21_F_SQRT2 1.4142135623730951
+#define S21_F_2_PI 0.6366197723675814
+#define S21_F_PIO2_1 1.57079632673412561417e+00  // 33 бита pi / 2
+#define S21_F_PIO2_1T 6.07710050650619224932e-11
+#define S21_F_PI_2 1.5707963267948966
+#define S21_F_PI_6 0.5235987755982989
+#define S21_F_TAN_PI_12 0.2679491924311227
+#define S21_F_SQRT3 1.7320508075688772
+
+// 1 + r + r^2/2! + ... + r^7/7!, |r| <= ln2 / 2
+static double s21_expf_poly(double r) {
+  return 1 + r * (1 + r * (1.0 / 2 + r * (1.0 / 6 + r * (1.0 / 24 +
+         r * (1.0 / 120 + r * (1.0 / 720 + r * (1.0 / 5040)))))));
+}
+
+// 2^k для -1022 <= k <= 1023
+static double s21_pow2f(int k) {
+  return s21_bits_double((uint64_t)(k + 1023) << 52);
+}
+
+// ln x через x = 2^e m, m в [sqrt(1/2), sqrt(2)), s = (m - 1) / (m + 1)
+static double s21_logf_core(double x, int *exponent) {
+  uint64_t bits = s21_double_bits(x);
+  int e = (int)((bits >> 52) & 0x7ff) - 1023;
+  double m = s21_bits_double((bits & 0xfffffffffffffULL) | 0x3ff0000000000000);
+  if (m > S21_F_SQRT2) {
+    m *= 0.5;
+    e++;
+  }
+  double s = (m - 1) / (m + 1), s2 = s * s;
+  *exponent = e;
+  return 2 * s *
+         (1 + s2 * (1.0 / 3 + s2 * (1.0 / 5 + s2 * (1.0 / 7 + s2 / 9))));
+}
+
+// sin и cos на |r| <= pi / 4, ряды Тейлора до r^9 и r^10
+static double s21_sinf_poly(double r) {
+  double r2 = r * r;
+  return r + r * r2 * (-1.0 / 6 + r2 * (1.0 / 120 + r2 * (-1.0 / 5040 +
+                       r2 * (1.0 / 362880))));
+}
+
+static double s21_cosf_poly(double r) {
+  double r2 = r * r;
+  return 1 + r2 * (-1.0 / 2 + r2 * (1.0 / 24 + r2 * (-1.0 / 720 +
+                   r2 * (1.0 / 40320 + r2 * (-1.0 / 3628800)))));
+}
+
+// приведение к [-pi/4, pi/4]: при |x| < 2^20 k * PIO2_1 точно в double,
+// дальше — точное приведение s21_rem_pio2 вплоть до FLT_MAX
+static int s21_rem_pio2f(double x, double *r) {
+  int q;
+  if (x > -1048576.0 && x < 1048576.0) {
+    double kf = x * S21_F_2_PI;
+    int k = (int)(kf < 0 ? kf - 0.5 : kf + 0.5);
+    *r = (x - k * S21_F_PIO2_1) - k * S21_F_PIO2_1T;
+    q = k & 3;
+  } else {
+    long double lr;
+    q = s21_rem_pio2(x, &lr);
+    *r = (double)lr;
+  }
+  return q;
+}
+
+float s21_atanf(float x) {
+  double a = x < 0 ? -(double)x : x;
+  double base = 0;
+  int inv = a > 1;
+  if (inv) a = 1 / a;
+  if (a > S21_F_TAN_PI_12) {
+    a = (a * S21_F_SQRT3 - 1) / (a + S21_F_SQRT3);
+    base = S21_F_PI_6;
+  }
+  double a2 = a * a;
+  double res = base + a * (1 + a2 * (-1.0 / 3 + a2 * (1.0 / 5 + a2 * (
+                              -1.0 / 7 + a2 * (1.0 / 9 + a2 * (-1.0 / 11 +
+                              a2 * (1.0 / 13 + a2 * (-1.0 / 15))))))));
+  if (inv) res = S21_F_PI_2 - res;
+  return x != x ? x : (float)(x < 0 ? -res : res);
+}
+
+float s21_ceilf(float x) {
+  float result = x;
+  if (s21_fabsf(x) < 8388608.0f) {  // от 2^23 все float целые
+    result = (float)(int32_t)x;
+    if (result < x) result += 1;
+  }
+  return result;
+}
+
+float s21_cosf(float x) {
+  float result;
+  if (x != x || S21_IS_INF(x)) {
+    result = S21_NAN;
+  } else {
+    double r;
+    int q = s21_rem_pio2f(x, &r);
+    double v = q % 2 ? s21_sinf_poly(r) : s21_cosf_poly(r);
+    result = (float)(q == 1 || q == 2 ? -v : v);
+  }
+  return result;
+}
+
+float s21_expf(float x) {
+  float result;
+  if (x != x) {
+    result = x;
+  } else if (x > 88.8f) {
+    result = S21_INF;
+  } else if (x < -104.0f) {
+    result = 0;
+  } else {
+    double kf = x * S21_F_LOG2E;
+    int k = (int)(kf < 0 ? kf - 0.5 : kf + 0.5);
+    result = (float)(s21_expf_poly(x - k * S21_F_LN2) * s21_pow2f(k));
+  }
+  return result;
+}
+
+float s21_exp2f(float x) {
+  float result;
+  if (x != x) {
+    result = x;
+  } else if (x > 128.1f) {
+    result = S21_INF;
+  } else if (x < -150.1f) {
+    result = 0;
+  } else {
+    int k = (int)(x < 0 ? x - 0.5f : x + 0.5f);
+    result = (float)(s21_expf_poly((x - k) * S21_F_LN2) * s21_pow2f(k));
+  }
+  return result;
+}
+
+float s21_fabsf(float x) { return x < 0 ? -x : x; }
+
+float s21_floorf(float x) {
+  float result = x;
+  if (s21_fabsf(x) < 8388608.0f) {
+    result = (float)(int32_t)x;
+    if (result > x) result -= 1;
+  }
+  return result;
+}
+
+float s21_logf(float x) {
+  float result;
+  if (x != x || x < 0) {
+    result = S21_NAN;
+  } else if (x == 0) {
+    result = S21_INF_NEG;
+  } else if (x == S21_INF) {
+    result = S21_INF;
+  } else {
+    int e;
+    double m = s21_logf_core(x, &e);
+    result = (float)(e * S21_F_LN2 + m);
+  }
+  return result;
+}
+
+float s21_log2f(float x) {
+  float result;
+  if (x != x || x < 0 || x == 0 || x == S21_INF) {
+    result = s21_logf(x);
+  } else {
+    int e;
+    double m = s21_logf_core(x, &e);
+    result = (float)(e + m * S21_F_LOG2E);
+  }
+  return result;
+}
+
+float s21_log10f(float x) {
+  float result;
+  if (x != x || x < 0 || x == 0 || x == S21_INF) {
+    result = s21_logf(x);
+  } else {
+    int e;
+    double m = s21_logf_core(x, &e);
+    result = (float)(e * S21_F_LOG10_2 + m * S21_F_LOG10E);
+  }
+  return result;
+}
+
+float s21_sinf(float x) {
+  float result;
+  if (x != x || S21_IS_INF(x)) {
+    result = S21_NAN;
+  } else {
+    double r;
+    int q = s21_rem_pio2f(x, &r);
+    double v = q % 2 ? s21_cosf_poly(r) : s21_sinf_poly(r);
+    result = (float)(q >= 2 ? -v : v);
+  }
+  return result;
+}
+
+// корень из double, округлённый до float, совпадает с корнем во float
+float s21_sqrtf(float x) {
+  float result;
+  if (x != x || x < 0) {
+    result = S21_NAN;
+  } else if (x == 0 || x == S21_INF) {
+    result = x;
+  } else {
+#if defined(__SSE__)
+    result = _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(x)));
+#else
+    result = (float)s21_sqrt_kernel(x);
+#endif
+  }
+  return result;
+}
+
+float s21_tanf(float x) {
+  float result;
+  if (x != x || S21_IS_INF(x)) {
+    result = S21_NAN;
+  } else {
+    double r;
+    int q = s21_rem_pio2f(x, &r);
+    double s = s21_sinf_poly(r), c = s21_cosf_poly(r);
+    result = (float)(q % 2 ? -c / s : s / c);
+  }
+  return result;
+}
@@ -0,0 +1,54 @@
+#include "s21_math.h"
+#include "utils.h"
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+// У каждого потока свой стек режимов: push сохраняет MXCSR и режим, pop
+// возвращает их. MXCSR управляет только SSE; вычисления в long double идут
+// через x87 и от режима не зависят, поэтому ядра сами обходят
+// денормализованные входы (s21_prescale), а пакетные exp и exp2 в режиме
+// S21_FTZ_DAZ сами заменяют нулём денормализованные результаты.
+
+#define S21_FP_DEPTH 16
+#define S21_MXCSR_DAZ 0x0040u
+#define S21_MXCSR_FTZ 0x8000u
+
+static _Thread_local s21_fp_mode s21_fp_current = S21_FP_STRICT;
+static _Thread_local s21_fp_mode s21_fp_modes[S21_FP_DEPTH];
+#if defined(__SSE__)
+static _Thread_local unsigned s21_fp_csr[S21_FP_DEPTH];
+#endif
+static _Thread_local int s21_fp_depth = 0;
+
+int s21_fp_mode_push(s21_fp_mode mode) {
+  int status = 0;
+  if (s21_fp_depth == S21_FP_DEPTH) {
+    status = -1;
+  } else {
+    s21_fp_modes[s21_fp_depth] = s21_fp_current;
+#if defined(__SSE__)
+    unsigned csr = _mm_getcsr();
+    s21_fp_csr[s21_fp_depth] = csr;
+    csr &= ~(S21_MXCSR_DAZ | S21_MXCSR_FTZ);
+    if (mode == S21_FTZ_DAZ) csr |= S21_MXCSR_DAZ | S21_MXCSR_FTZ;
+    _mm_setcsr(csr);
+#endif
+    s21_fp_depth++;
+    s21_fp_current = mode;
+  }
+  return status;
+}
+
+void s21_fp_mode_pop(void) {
+  if (s21_fp_depth > 0) {
+    s21_fp_depth--;
+    s21_fp_current = s21_fp_modes[s21_fp_depth];
+#if defined(__SSE__)
+    _mm_setcsr(s21_fp_csr[s21_fp_depth]);
+#endif
+  }
+}
+
+s21_fp_mode s21_fp_mode_get(void) { return s21_fp_current; }
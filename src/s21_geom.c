@@ -0,0 +1,292 @@
+#include "s21_math.h"
+#include "utils.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Геометрические преобразования над массивами координат. Векторный путь
+// считает S21_VL точек сразу в double: sin и cos — приведение Коди — Уэйта
+// и многочлены fdlibm, atan2 — сведение к |t| <= tan(pi/12) и ряд, длина
+// вектора — sqrt(x^2 + y^2). Группы, где есть аргументы вне рабочего
+// диапазона (большие углы, нули, бесконечности, NaN, слишком большие или
+// малые координаты), и хвосты считаются скалярными ядрами в long double.
+
+#if defined(__AVX__)
+typedef __m256d s21_vd;
+#define S21_VL 4
+#define s21_vload _mm256_loadu_pd
+#define s21_vstore _mm256_storeu_pd
+#define s21_vset1 _mm256_set1_pd
+#define s21_vadd _mm256_add_pd
+#define s21_vsub _mm256_sub_pd
+#define s21_vmul _mm256_mul_pd
+#define s21_vdiv _mm256_div_pd
+#define s21_vsqrt _mm256_sqrt_pd
+#define s21_vmin _mm256_min_pd
+#define s21_vmax _mm256_max_pd
+#define s21_vand _mm256_and_pd
+#define s21_vandnot _mm256_andnot_pd
+#define s21_vor _mm256_or_pd
+#define s21_vxor _mm256_xor_pd
+#define s21_veq(a, b) _mm256_cmp_pd(a, b, _CMP_EQ_OQ)
+#define s21_vlt(a, b) _mm256_cmp_pd(a, b, _CMP_LT_OQ)
+#define s21_vle(a, b) _mm256_cmp_pd(a, b, _CMP_LE_OQ)
+#define s21_vmask _mm256_movemask_pd
+#elif defined(__SSE2__)
+typedef __m128d s21_vd;
+#define S21_VL 2
+#define s21_vload _mm_loadu_pd
+#define s21_vstore _mm_storeu_pd
+#define s21_vset1 _mm_set1_pd
+#define s21_vadd _mm_add_pd
+#define s21_vsub _mm_sub_pd
+#define s21_vmul _mm_mul_pd
+#define s21_vdiv _mm_div_pd
+#define s21_vsqrt _mm_sqrt_pd
+#define s21_vmin _mm_min_pd
+#define s21_vmax _mm_max_pd
+#define s21_vand _mm_and_pd
+#define s21_vandnot _mm_andnot_pd
+#define s21_vor _mm_or_pd
+#define s21_vxor _mm_xor_pd
+#define s21_veq _mm_cmpeq_pd
+#define s21_vlt _mm_cmplt_pd
+#define s21_vle _mm_cmple_pd
+#define s21_vmask _mm_movemask_pd
+#endif
+
+#define S21_GEOM_MAX_ANGLE 1e5  // |k| < 2^16: k * PIO2_1 и k * PIO2_2 точны
+#define S21_GEOM_MIN_COORD 1e-150  // квадраты не уходят в денормализованные
+#define S21_GEOM_MAX_COORD 1e150   // и не переполняются
+
+#if defined(S21_VL)
+#define S21_ALL_LANES ((1 << S21_VL) - 1)
+#define S21_ROUND_MAGIC 6755399441055744.0  // 1.5 * 2^52
+
+#define S21_2_PI_D 6.36619772367581382433e-01
+#define S21_PIO2_1 1.57079632673412561417e+00  // первые 33 бита pi / 2
+#define S21_PIO2_2 6.07710050630396597660e-11  // следующие 33 бита
+#define S21_PIO2_2T 2.02226624879595063154e-21
+#define S21_PI_D 3.14159265358979311600e+00
+#define S21_PI_2_D 1.57079632679489655800e+00
+#define S21_PI_6_D 5.23598775598298815658e-01
+#define S21_TAN_PI_12_D 2.67949192431122695603e-01
+#define S21_SQRT3_D 1.73205080756887719318e+00
+
+static const double s21_vsin_coef[6] = {
+    -1.66666666666666324348e-01, 8.33333333332248946124e-03,
+    -1.98412698298579493134e-04, 2.75573137070700676789e-06,
+    -2.50507602534068634195e-08, 1.58969099521155010221e-10};
+static const double s21_vcos_coef[6] = {
+    4.16666666666666019037e-02,  -1.38888888888741095749e-03,
+    2.48015872894767294178e-05,  -2.75573143513906633035e-07,
+    2.08757232129817482790e-09,  -1.13596475577881948265e-11};
+
+static inline s21_vd s21_vround(s21_vd x) {
+  s21_vd m = s21_vset1(S21_ROUND_MAGIC);
+  return s21_vsub(s21_vadd(x, m), m);
+}
+
+static inline s21_vd s21_vabs(s21_vd x) {
+  return s21_vandnot(s21_vset1(-0.0), x);
+}
+
+// mask ? a : b
+static inline s21_vd s21_vselect(s21_vd mask, s21_vd a, s21_vd b) {
+  return s21_vor(s21_vand(mask, a), s21_vandnot(mask, b));
+}
+
+static inline s21_vd s21_vpoly(const double *coef, int degree, s21_vd x) {
+  s21_vd res = s21_vset1(coef[degree]);
+  for (int i = degree - 1; i >= 0; i--) {
+    res = s21_vadd(s21_vmul(res, x), s21_vset1(coef[i]));
+  }
+  return res;
+}
+
+// |x| <= S21_GEOM_MAX_ANGLE, x не NaN
+static void s21_vsincos(s21_vd x, s21_vd *s, s21_vd *c) {
+  s21_vd k = s21_vround(s21_vmul(x, s21_vset1(S21_2_PI_D)));
+  s21_vd r = s21_vsub(x, s21_vmul(k, s21_vset1(S21_PIO2_1)));
+  r = s21_vsub(r, s21_vmul(k, s21_vset1(S21_PIO2_2)));
+  r = s21_vsub(r, s21_vmul(k, s21_vset1(S21_PIO2_2T)));
+  // четверть q = k mod 4; floor(k / 4) = round(k / 4 - 3 / 8)
+  s21_vd fl = s21_vround(s21_vsub(s21_vmul(k, s21_vset1(0.25)),
+                                  s21_vset1(0.375)));
+  s21_vd q = s21_vsub(k, s21_vmul(fl, s21_vset1(4)));
+  s21_vd z = s21_vmul(r, r);
+  s21_vd sr = s21_vadd(r, s21_vmul(s21_vmul(r, z),
+                                   s21_vpoly(s21_vsin_coef, 5, z)));
+  // cos r = w + ((1 - w) - z / 2 + z^2 P(z)), w = 1 - z / 2
+  s21_vd hz = s21_vmul(z, s21_vset1(0.5));
+  s21_vd w = s21_vsub(s21_vset1(1), hz);
+  s21_vd tail = s21_vmul(s21_vmul(z, z), s21_vpoly(s21_vcos_coef, 5, z));
+  s21_vd cr = s21_vadd(w, s21_vadd(s21_vsub(s21_vsub(s21_vset1(1), w), hz),
+                                   tail));
+  s21_vd odd = s21_vor(s21_veq(q, s21_vset1(1)), s21_veq(q, s21_vset1(3)));
+  s21_vd sin_neg = s21_vle(s21_vset1(2), q);
+  s21_vd cos_neg = s21_vor(s21_veq(q, s21_vset1(1)), s21_veq(q, s21_vset1(2)));
+  s21_vd sign = s21_vset1(-0.0);
+  *s = s21_vxor(s21_vselect(odd, cr, sr), s21_vand(sin_neg, sign));
+  *c = s21_vxor(s21_vselect(odd, sr, cr), s21_vand(cos_neg, sign));
+}
+
+// 1, если все углы группы в рабочем диапазоне
+static inline int s21_vangles_ok(s21_vd x) {
+  s21_vd ok = s21_vle(s21_vabs(x), s21_vset1(S21_GEOM_MAX_ANGLE));
+  return s21_vmask(ok) == S21_ALL_LANES;
+}
+
+// atan(t) для |t| <= tan(pi / 12): ряд до t^27
+static inline s21_vd s21_vatan_small(s21_vd t) {
+  static const double coef[14] = {
+      1.0,        -1.0 / 3,  1.0 / 5,  -1.0 / 7,  1.0 / 9,  -1.0 / 11,
+      1.0 / 13,   -1.0 / 15, 1.0 / 17, -1.0 / 19, 1.0 / 21, -1.0 / 23,
+      1.0 / 25,   -1.0 / 27};
+  return s21_vmul(t, s21_vpoly(coef, 13, s21_vmul(t, t)));
+}
+
+// угол и длина; координаты группы в [S21_GEOM_MIN_COORD, S21_GEOM_MAX_COORD]
+// по большей из |x|, |y|
+static void s21_vpolar(s21_vd x, s21_vd y, s21_vd *r, s21_vd *theta) {
+  s21_vd ax = s21_vabs(x), ay = s21_vabs(y);
+  s21_vd lo = s21_vmin(ax, ay), hi = s21_vmax(ax, ay);
+  s21_vd a = s21_vdiv(lo, hi);
+  // atan a = pi / 6 + atan((a sqrt3 - 1) / (a + sqrt3)) при a > tan(pi/12)
+  s21_vd big = s21_vlt(s21_vset1(S21_TAN_PI_12_D), a);
+  s21_vd sqrt3 = s21_vset1(S21_SQRT3_D);
+  s21_vd shifted = s21_vdiv(s21_vsub(s21_vmul(a, sqrt3), s21_vset1(1)),
+                            s21_vadd(a, sqrt3));
+  s21_vd t = s21_vadd(s21_vand(big, s21_vset1(S21_PI_6_D)),
+                      s21_vatan_small(s21_vselect(big, shifted, a)));
+  t = s21_vselect(s21_vlt(ax, ay), s21_vsub(s21_vset1(S21_PI_2_D), t), t);
+  // при x = -0 обе ветви дают pi / 2, поэтому хватает сравнения с нулём
+  s21_vd x_neg = s21_vlt(x, s21_vset1(0));
+  t = s21_vselect(x_neg, s21_vsub(s21_vset1(S21_PI_D), t), t);
+  *theta = s21_vor(t, s21_vand(y, s21_vset1(-0.0)));
+  *r = s21_vsqrt(s21_vadd(s21_vmul(x, x), s21_vmul(y, y)));
+}
+
+// maxpd при NaN в первом операнде отдаёт второй, поэтому верхняя граница
+// проверяется по каждой координате: упорядоченное сравнение с NaN ложно
+static inline int s21_vcoords_ok(s21_vd x, s21_vd y) {
+  s21_vd ax = s21_vabs(x), ay = s21_vabs(y);
+  s21_vd max = s21_vset1(S21_GEOM_MAX_COORD);
+  s21_vd ok = s21_vand(s21_vle(ax, max), s21_vle(ay, max));
+  ok = s21_vand(ok, s21_vle(s21_vset1(S21_GEOM_MIN_COORD), s21_vmax(ax, ay)));
+  return s21_vmask(ok) == S21_ALL_LANES;
+}
+#endif
+
+static inline void s21_polar_to_cart_one(double r, double theta, double *x,
+                                         double *y) {
+  long double s, c;
+  s21_sincos_kernel(theta, &s, &c);
+  *x = (double)(r * c);
+  *y = (double)(r * s);
+}
+
+static inline void s21_cart_to_polar_one(double x, double y, double *r,
+                                         double *theta) {
+  long double t = s21_atan2_kernel(y, x);
+  *r = (double)s21_hypot_kernel(x, y);
+  *theta = (double)t;
+}
+
+void s21_rotate2d_n(double angle, const double *x, const double *y,
+                    double *res_x, double *res_y, size_t n) {
+  long double ls, lc;
+  s21_sincos_kernel(angle, &ls, &lc);
+  double s = (double)ls, c = (double)lc;
+  size_t i = 0;
+#if defined(S21_VL)
+  s21_vd vs = s21_vset1(s), vc = s21_vset1(c);
+  for (; i + S21_VL <= n; i += S21_VL) {
+    s21_vd vx = s21_vload(x + i), vy = s21_vload(y + i);
+    s21_vstore(res_x + i, s21_vsub(s21_vmul(vc, vx), s21_vmul(vs, vy)));
+    s21_vstore(res_y + i, s21_vadd(s21_vmul(vs, vx), s21_vmul(vc, vy)));
+  }
+#endif
+  for (; i < n; i++) {
+    double xi = x[i], yi = y[i];
+    res_x[i] = c * xi - s * yi;
+    res_y[i] = s * xi + c * yi;
+  }
+}
+
+void s21_polar_to_cart_n(const double *r, const double *theta, double *x,
+                         double *y, size_t n) {
+  size_t i = 0;
+#if defined(S21_VL)
+  for (; i + S21_VL <= n; i += S21_VL) {
+    s21_vd vt = s21_vload(theta + i);
+    if (s21_vangles_ok(vt)) {
+      s21_vd vr = s21_vload(r + i), vs, vc;
+      s21_vsincos(vt, &vs, &vc);
+      s21_vstore(x + i, s21_vmul(vr, vc));
+      s21_vstore(y + i, s21_vmul(vr, vs));
+    } else {
+      for (size_t k = i; k < i + S21_VL; k++) {
+        s21_polar_to_cart_one(r[k], theta[k], x + k, y + k);
+      }
+    }
+  }
+#endif
+  for (; i < n; i++) s21_polar_to_cart_one(r[i], theta[i], x + i, y + i);
+}
+
+void s21_cart_to_polar_n(const double *x, const double *y, double *r,
+                         double *theta, size_t n) {
+  size_t i = 0;
+#if defined(S21_VL)
+  for (; i + S21_VL <= n; i += S21_VL) {
+    s21_vd vx = s21_vload(x + i), vy = s21_vload(y + i);
+    if (s21_vcoords_ok(vx, vy)) {
+      s21_vd vr, vt;
+      s21_vpolar(vx, vy, &vr, &vt);
+      s21_vstore(r + i, vr);
+      s21_vstore(theta + i, vt);
+    } else {
+      for (size_t k = i; k < i + S21_VL; k++) {
+        s21_cart_to_polar_one(x[k], y[k], r + k, theta + k);
+      }
+    }
+  }
+#endif
+  for (; i < n; i++) s21_cart_to_polar_one(x[i], y[i], r + i, theta + i);
+}
+
+// Матрица поворота для q / |q|: элементы вида 1 - 2 (y^2 + z^2) / |q|^2
+void s21_quat_to_matrix(const double q[4], double m[9]) {
+  long double w = q[0], x = q[1], y = q[2], z = q[3];
+  long double norm = w * w + x * x + y * y + z * z;
+  long double s = norm > 0 ? 2 / norm : 0;
+  m[0] = (double)(1 - s * (y * y + z * z));
+  m[1] = (double)(s * (x * y - w * z));
+  m[2] = (double)(s * (x * z + w * y));
+  m[3] = (double)(s * (x * y + w * z));
+  m[4] = (double)(1 - s * (x * x + z * z));
+  m[5] = (double)(s * (y * z - w * x));
+  m[6] = (double)(s * (x * z - w * y));
+  m[7] = (double)(s * (y * z + w * x));
+  m[8] = (double)(1 - s * (x * x + y * y));
+}
+
+// через кватернион (cos(a / 2), sin(a / 2) * axis / |axis|): при малых
+// углах 1 - cos a не теряет точность
+void s21_axis_angle_to_matrix(const double axis[3], double angle,
+                              double m[9]) {
+  long double len = s21_hypot_kernel(s21_hypot_kernel(axis[0], axis[1]),
+                                     axis[2]);
+  long double s, c;
+  s21_sincos_kernel((long double)angle / 2, &s, &c);
+  double q[4] = {1, 0, 0, 0};
+  if (len > 0) {
+    q[0] = (double)c;
+    for (int i = 0; i < 3; i++) q[i + 1] = (double)(s * axis[i] / len);
+  }
+  s21_quat_to_matrix(q, m);
+}
@@ -0,0 +1,227 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "s21_math.h"
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+// Пакетные ядра для fp16/bf16: блок входа расширяется до float, считается
+// и сразу сужается обратно, так что данные проходят через память один раз.
+// Степени многочленов подобраны под 11-битную (fp16) и 8-битную (bf16)
+// мантиссу.
+
+#define S21_HALF_BLOCK 256
+#define S21_FMT_F16 0
+#define S21_FMT_BF16 1
+
+static const float s21_expf_coef[6] = {1.0f,     1.0f,      1.0f / 2,
+                                       1.0f / 6, 1.0f / 24, 1.0f / 120};
+static const float s21_logf_coef[3] = {1.0f, 1.0f / 3, 1.0f / 5};
+static const float s21_tanhf_coef[5] = {1.0f, -1.0f / 3, 2.0f / 15,
+                                        -17.0f / 315, 62.0f / 2835};
+
+// степени многочленов exp (по r) и log (по s^2) для fp16 и bf16
+static const int s21_exp_degree[2] = {4, 3};
+static const int s21_log_degree[2] = {2, 1};
+
+static uint32_t s21_float_bits(float x) {
+  uint32_t u;
+  memcpy(&u, &x, sizeof(u));
+  return u;
+}
+
+static float s21_bits_float(uint32_t u) {
+  float x;
+  memcpy(&x, &u, sizeof(x));
+  return x;
+}
+
+static float s21_polyf(const float *coef, int degree, float x) {
+  float res = coef[degree];
+  for (int i = degree - 1; i >= 0; --i) res = res * x + coef[i];
+  return res;
+}
+
+float s21_f16_to_float(uint16_t h) {
+  uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+  uint32_t exp = (h >> 10) & 0x1f;
+  uint32_t mant = h & 0x3ff;
+  float res;
+  if (exp == 0x1f) {
+    res = s21_bits_float(sign | 0x7f800000 | (mant << 13));
+  } else if (exp != 0) {
+    res = s21_bits_float(sign | ((exp + 112) << 23) | (mant << 13));
+  } else {
+    res = (float)mant * 5.9604644775390625e-8f;  // mant * 2^-24
+    if (sign) res = -res;
+  }
+  return res;
+}
+
+uint16_t s21_float_to_f16(float f) {
+  uint32_t x = s21_float_bits(f);
+  uint16_t sign = (x >> 16) & 0x8000;
+  uint32_t a = x & 0x7fffffff;
+  uint16_t res;
+  if (a > 0x7f800000) {
+    res = sign | 0x7e00;
+  } else if (a >= 0x477ff000) {  // >= 65520 округляется в бесконечность
+    res = sign | 0x7c00;
+  } else if (a < 0x38800000) {  // < 2^-14: денормализованное fp16
+    float m = s21_bits_float(a) * 16777216.0f + 8388608.0f;
+    res = sign | (uint16_t)(s21_float_bits(m) - 0x4b000000);
+  } else {
+    uint32_t r = a - (112u << 23);
+    r += 0xfff + ((r >> 13) & 1);
+    res = sign | (uint16_t)(r >> 13);
+  }
+  return res;
+}
+
+float s21_bf16_to_float(uint16_t h) {
+  return s21_bits_float((uint32_t)h << 16);
+}
+
+uint16_t s21_float_to_bf16(float f) {
+  uint32_t x = s21_float_bits(f);
+  uint16_t res;
+  if ((x & 0x7fffffff) > 0x7f800000) {
+    res = (uint16_t)((x >> 16) | 0x40);
+  } else {
+    res = (uint16_t)((x + 0x7fff + ((x >> 16) & 1)) >> 16);
+  }
+  return res;
+}
+
+// 2^k для k из [-252, 254]
+static float s21_scale2f(float x, int k) {
+  int half = k / 2;
+  return x * s21_bits_float((uint32_t)(half + 127) << 23) *
+         s21_bits_float((uint32_t)(k - half + 127) << 23);
+}
+
+static float s21_expf_half(float x, int fmt) {
+  float res;
+  if (x != x) {
+    res = x;
+  } else if (x > 89.0f) {
+    res = S21_INF;
+  } else if (x < -104.0f) {
+    res = 0.0f;
+  } else {
+    float kf = x * 1.44269504f;
+    int k = (int)(kf < 0 ? kf - 0.5f : kf + 0.5f);
+    float r = x - k * 0.693147181f;
+    res = s21_scale2f(s21_polyf(s21_expf_coef, s21_exp_degree[fmt], r), k);
+  }
+  return res;
+}
+
+static float s21_logf_half(float x, int fmt) {
+  float res;
+  if (x != x || x < 0) {
+    res = S21_NAN;
+  } else if (x == 0) {
+    res = S21_INF_NEG;
+  } else if (x == S21_INF) {
+    res = x;
+  } else {
+    int e = 0;
+    if (x < 1.17549435e-38f) {
+      x *= 8388608.0f;  // 2^23
+      e = -23;
+    }
+    uint32_t u = s21_float_bits(x);
+    e += (int)(u >> 23) - 127;
+    float m = s21_bits_float((u & 0x7fffff) | 0x3f800000);
+    if (m > 1.41421356f) {
+      m *= 0.5f;
+      e++;
+    }
+    float s = (m - 1) / (m + 1);
+    res = e * 0.693147181f +
+          2 * s * s21_polyf(s21_logf_coef, s21_log_degree[fmt], s * s);
+  }
+  return res;
+}
+
+static float s21_tanhf_half(float x, int fmt) {
+  float res;
+  float a = x < 0 ? -x : x;
+  if (a < 0.625f) {
+    res = x * s21_polyf(s21_tanhf_coef, 4, x * x);
+  } else {
+    res = 1 - 2 / (s21_expf_half(2 * a, fmt) + 1);
+    if (x < 0) res = -res;
+  }
+  return res;
+}
+
+static void s21_half_load(const uint16_t *x, float *buf, size_t m, int fmt) {
+  size_t i = 0;
+  if (fmt == S21_FMT_F16) {
+#if defined(__F16C__)
+    for (; i + 8 <= m; i += 8) {
+      __m128i h = _mm_loadu_si128((const __m128i *)(x + i));
+      _mm256_storeu_ps(buf + i, _mm256_cvtph_ps(h));
+    }
+#endif
+    for (; i < m; i++) buf[i] = s21_f16_to_float(x[i]);
+  } else {
+    for (; i < m; i++) buf[i] = s21_bf16_to_float(x[i]);
+  }
+}
+
+static void s21_half_store(const float *buf, uint16_t *res, size_t m,
+                           int fmt) {
+  size_t i = 0;
+  if (fmt == S21_FMT_F16) {
+#if defined(__F16C__)
+    for (; i + 8 <= m; i += 8) {
+      __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(buf + i),
+                                  _MM_FROUND_TO_NEAREST_INT);
+      _mm_storeu_si128((__m128i *)(res + i), h);
+    }
+#endif
+    for (; i < m; i++) res[i] = s21_float_to_f16(buf[i]);
+  } else {
+    for (; i < m; i++) res[i] = s21_float_to_bf16(buf[i]);
+  }
+}
+
+static void s21_half_apply(const uint16_t *x, uint16_t *res, size_t n,
+                           int fmt, float (*fn)(float, int)) {
+  float buf[S21_HALF_BLOCK];
+  for (size_t start = 0; start < n; start += S21_HALF_BLOCK) {
+    size_t m = n - start < S21_HALF_BLOCK ? n - start : S21_HALF_BLOCK;
+    s21_half_load(x + start, buf, m, fmt);
+    for (size_t i = 0; i < m; i++) buf[i] = fn(buf[i], fmt);
+    s21_half_store(buf, res + start, m, fmt);
+  }
+}
+
+void s21_exp_f16_n(const uint16_t *x, uint16_t *res, size_t n) {
+  s21_half_apply(x, res, n, S21_FMT_F16, s21_expf_half);
+}
+
+void s21_log_f16_n(const uint16_t *x, uint16_t *res, size_t n) {
+  s21_half_apply(x, res, n, S21_FMT_F16, s21_logf_half);
+}
+
+void s21_tanh_f16_n(const uint16_t *x, uint16_t *res, size_t n) {
+  s21_half_apply(x, res, n, S21_FMT_F16, s21_tanhf_half);
+}
+
+void s21_exp_bf16_n(const uint16_t *x, uint16_t *res, size_t n) {
+  s21_half_apply(x, res, n, S21_FMT_BF16, s21_expf_half);
+}
+
+void s21_log_bf16_n(const uint16_t *x, uint16_t *res, size_t n) {
+  s21_half_apply(x, res, n, S21_FMT_BF16, s21_logf_half);
+}
+
+void s21_tanh_bf16_n(const uint16_t *x, uint16_t *res, size_t n) {
+  s21_half_apply(x, res, n, S21_FMT_BF16, s21_tanhf_half);
+}
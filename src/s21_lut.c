@@ -0,0 +1,116 @@
+#include <stdlib.h>
+
+#include "s21_math.h"
+
+// Таблица значений функции на [a, b] с равномерным шагом. Для кубической
+// интерполяции по краям хранятся два дополнительных узла, полученных
+// кубической экстраполяцией, чтобы не вычислять f вне области.
+struct s21_lut {
+  double a, b;
+  double inv_h;
+  size_t size;
+  s21_lut_interp interp;
+  double max_error;
+  double *data;  // size + 2 значения, узел i хранится в data[i + 1]
+};
+
+// интервал делится на S21_LUT_PROBES частей, погрешность оценивается во
+// внутренних точках деления (включая середину, где ошибка линейной и
+// ступенчатой интерполяции максимальна)
+#define S21_LUT_PROBES 8
+
+s21_lut *s21_lut_create(long double (*f)(double), double a, double b,
+                        size_t size, s21_lut_interp interp) {
+  s21_lut *lut = NULL;
+  if (f != NULL && a < b && size >= 4 && interp >= S21_LUT_NEAREST &&
+      interp <= S21_LUT_CUBIC) {
+    lut = malloc(sizeof(*lut));
+  }
+  if (lut != NULL) {
+    lut->data = malloc((size + 2) * sizeof(*lut->data));
+    if (lut->data == NULL) {
+      free(lut);
+      lut = NULL;
+    }
+  }
+  if (lut != NULL) {
+    double h = (b - a) / (size - 1);
+    double *v = lut->data + 1;
+    lut->a = a;
+    lut->b = b;
+    lut->inv_h = 1 / h;
+    lut->size = size;
+    lut->interp = interp;
+    for (size_t i = 0; i < size; i++) {
+      v[i] = f(i == size - 1 ? b : a + i * h);
+    }
+    v[-1] = 4 * v[0] - 6 * v[1] + 4 * v[2] - v[3];
+    v[size] =
+        4 * v[size - 1] - 6 * v[size - 2] + 4 * v[size - 3] - v[size - 4];
+
+    lut->max_error = 0;
+    for (size_t i = 0; i + 1 < size; i++) {
+      for (int k = 1; k < S21_LUT_PROBES; k++) {
+        double x = a + (i + (double)k / S21_LUT_PROBES) * h;
+        double fx = f(x);
+        double err = s21_fabs(s21_lut_eval(lut, x) - fx);
+        if (interp == S21_LUT_NEAREST && 2 * k == S21_LUT_PROBES) {
+          double left = s21_fabs(v[i] - fx);
+          if (left > err) err = left;
+        }
+        if (err > lut->max_error || err != err) lut->max_error = err;
+      }
+    }
+  }
+  return lut;
+}
+
+void s21_lut_free(s21_lut *lut) {
+  if (lut != NULL) {
+    free(lut->data);
+    free(lut);
+  }
+}
+
+// значение для x не NaN: вне [a, b] — значение на ближайшем конце
+static double s21_lut_value(const s21_lut *lut, double x) {
+  const double *v = lut->data + 1;
+  double u = (x - lut->a) * lut->inv_h;
+  double last = (double)(lut->size - 1);
+  if (!(u > 0)) u = 0;
+  if (u > last) u = last;
+  double res;
+  if (lut->interp == S21_LUT_NEAREST) {
+    res = v[(size_t)(u + 0.5)];
+  } else {
+    size_t i = (size_t)u;
+    if (i > lut->size - 2) i = lut->size - 2;
+    double t = u - i;
+    if (lut->interp == S21_LUT_LINEAR) {
+      res = v[i] + t * (v[i + 1] - v[i]);
+    } else {
+      // Лагранж по узлам i-1, i, i+1, i+2
+      double p0 = v[i - 1], p1 = v[i], p2 = v[i + 1], p3 = v[i + 2];
+      double c1 = p2 - p0 / 3 - p1 / 2 - p3 / 6;
+      double c2 = (p0 + p2) / 2 - p1;
+      double c3 = (p3 - p0) / 6 + (p1 - p2) / 2;
+      res = p1 + t * (c1 + t * (c2 + t * c3));
+    }
+  }
+  return res;
+}
+
+double s21_lut_eval(const s21_lut *lut, double x) {
+  return x != x ? x : s21_lut_value(lut, x);
+}
+
+void s21_lut_eval_n(const s21_lut *lut, const double *x, double *res,
+                    size_t n) {
+  for (size_t i = 0; i < n; i++) res[i] = s21_lut_eval(lut, x[i]);
+}
+
+double s21_lut_max_error(const s21_lut *lut) { return lut->max_error; }
+
+size_t s21_lut_memory(const s21_lut *lut) {
+  return sizeof(*lut) + (lut->size + 2) * sizeof(*lut->data);
+}
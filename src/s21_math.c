@@ -13,65 +13,55 @@ long double s21_acos(double x) {
   long double result;
   if (x < -1.0 || x > 1.0 || x != x) {
     result = S21_NAN;
-  } else {
-    result = S21_PI / 2 - s21_asin(x);
+  } else if (!s21_memo_find(S21_MEMO_ACOS, x, 0, &result)) {
+    result = s21_acos_kernel(x);
+    s21_memo_store(S21_MEMO_ACOS, x, 0, result);
   }
   return result;
 }
 
 long double s21_asin(double x) {
-  long double result = 0;
-  if (x < -1.0 || x > 1.0) {
+  long double result;
+  if (x < -1.0 || x > 1.0 || x != x) {
     result = S21_NAN;
-  } else if (x == 1) {
-    result = S21_PI / 2;
-  } else if (x == -1) {
-    result = -S21_PI / 2;
-  } else {
-    result = x;
-    long double temp = x;
-    int i = 1;
-    while (s21_fabs(temp) >= S21_EPS && i <= 400000) {
-      temp =
-          (s21_factorial(2 * i) * s21_int_pow(x, (unsigned int)(2 * i + 1))) /
-          (s21_int_pow(4.0, (unsigned int)(i)) * s21_factorial(i) *
-           s21_factorial(i) * (2 * i + 1));
-      result += temp;
-      i++;
-    }
+  } else if (!s21_memo_find(S21_MEMO_ASIN, x, 0, &result)) {
+    result = s21_asin_kernel(x);
+    s21_memo_store(S21_MEMO_ASIN, x, 0, result);
   }
   return result;
 }
 
 long double s21_atan(double x) {
-  long double result = 0;
-  int sign = 1;
-  if (x < 0) {
-    x *= -1;
-    sign = -1;
-  }
+  long double result;
   if (x != x) {
     result = S21_NAN;
-  } else if (x == S21_INF || x >= 1e7) {
-    result = S21_PI / 2 * sign;
-  } else if (x == 1) {
-    result = S21_PI / 4 * sign;
-  } else if (x > 1) {
-    x = 1 / x;
-    result = S21_PI / 2 - s21_atan(x);
-    result *= sign;
+  } else if (S21_IS_INF(x)) {
+    result = x < 0 ? -S21_PI_L / 2 : S21_PI_L / 2;
   } else {
+    result = s21_atan_kernel(s21_fabs(x));
+    if (x < 0) result = -result;
+  }
+  return result;
+}
+
+long double s21_cbrt(double x) {
+  long double result;
+  if (x != x || x == 0 || S21_IS_INF(x)) {
     result = x;
-    double alter = -1.0;
-    int n = 2;
-    while (n < 20) {
-      result += (s21_pow(x, (2 * n - 1)) / (2 * n - 1) * alter);
-      ++n;
-      alter *= -1.0;
+  } else {
+    int scale;
+    double a = s21_prescale(s21_fabs(x), &scale);
+    scale /= 3;
+    // начальное приближение делением показателя на 3, затем три шага Галлея
+    long double y =
+        s21_bits_double(s21_double_bits(a) / 3 + 0x2a9f7893782da1ceULL);
+    for (int i = 0; i < 3; i++) {
+      long double y3 = y * y * y;
+      y = y * (y3 + 2 * a) / (2 * y3 + a);
     }
-    result *= sign;
+    result = s21_scale2(y, scale);
+    if (x < 0) result = -result;
   }
-
   return result;
 }
 
@@ -89,50 +79,54 @@ long double s21_ceil(double x) {
   return result;
 }
 
-long double s21_cos(double x) {
-  long double result = 0.0;
+long double s21_cos(double x) { return s21_cosl(x); }
+
+long double s21_erf(double x) {
+  long double result;
   if (x != x) {
-    result = S21_NAN;
-  } else if (x == S21_INF || x == -S21_INF) {
-    result = S21_NAN;
+    result = x;
+  } else if (x > -2.5 && x < 2.5) {
+    result = s21_erf_kernel(x);
   } else {
-    long double x1 = s21_fmod(x, 2 * S21_PI);
-    long double temp = 1.;
-    int i = 0;
-    while (s21_fabs(temp) >= S21_EPS) {
-      result += temp;
-      i++;
-      temp *= -x1 * x1 / (i * (i + 1));
-      i++;
-    }
+    result = 1 - s21_erfc_kernel(s21_fabs(x));
+    if (x < 0) result = -result;
+  }
+  return result;
+}
+
+long double s21_erfc(double x) {
+  long double result;
+  if (x != x) {
+    result = x;
+  } else if (x >= 0.5) {
+    result = s21_erfc_kernel(x);
+  } else if (x <= -0.5) {
+    result = 2 - s21_erfc_kernel(-x);
+  } else {
+    result = 1 - s21_erf_kernel(x);  // erf(x) < 0.53: вычитание без потерь
   }
   return result;
 }
 
 long double s21_exp(double x) {
-  long double result = 1;
-  if (x == 0) {
-    result = 1;
-  } else if (x < -20) {
-    result = 0;
-  } else if (x != x) {
+  long double result;
+  if (!s21_memo_find(S21_MEMO_EXP, x, 0, &result)) {
+    result = s21_exp_kernel(x);
+    s21_memo_store(S21_MEMO_EXP, x, 0, result);
+  }
+  return result;
+}
+
+long double s21_exp2(double x) { return s21_exp2_kernel(x); }
+
+long double s21_exp10(double x) { return s21_exp_kernel(x * S21_LN10); }
+
+long double s21_expm1(double x) {
+  long double result;
+  if (x != x) {
     result = S21_NAN;
-  } else if (x > 709) {
-    result = S21_INF;
   } else {
-    double x0 = x;
-    if (x0 < 0) x0 = -x0;
-    long double temp = 1;
-    long double num = x0;
-    long double i = 1;
-    while (temp > 1e-17) {
-      temp *= num / i;
-      result += temp;
-      ++i;
-    }
-    if (x < 0) {
-      result = 1 / result;
-    }
+    result = s21_expm1_kernel(x);
   }
   return result;
 }
@@ -174,6 +168,22 @@ long double s21_fmod(double x, double y) {  // нахождение остатк
   return ostatok;
 }
 
+long double s21_lgamma(double x) {
+  long double result;
+  int sign;
+  if (x != x) {
+    result = x;
+  } else if (S21_IS_INF(x)) {
+    result = S21_INF;
+  } else if (x <= 0 && s21_sinpi_kernel(x) == 0) {
+    result = S21_INF;  // полюса 0, -1, -2, ...
+  } else if (!s21_memo_find(S21_MEMO_LGAMMA, x, 0, &result)) {
+    result = s21_lgamma_kernel(x, &sign);
+    s21_memo_store(S21_MEMO_LGAMMA, x, 0, result);
+  }
+  return result;
+}
+
 long double s21_log(
     double x) {  //функцияпоиска логарифма, обратная возвед в степень
   if (x == S21_INF) return x;
@@ -182,6 +192,19 @@ long double s21_log(
 
   int ex_pow = 0;  //счетчик количества экспоненты в х
   long double result = 0;  // значение логарифма
+  if (s21_memo_find(S21_MEMO_LOG, x, 0, &result)) return result;
+  double arg = x;
+  int scale = 0;  // исходный x = x * 2^scale
+
+  // малые x приводятся к [1, 2) по порядку: из нуля ста шагов Ньютона
+  // хватает только до x ~ e^-200, а денормализованные x замедляют каждый.
+  // Вблизи 1 порядок не отделяется, иначе ln m - ln 2 теряет точность
+  if (x < 0.5) {
+    x = s21_prescale(x, &scale);
+    uint64_t bits = s21_double_bits(x);
+    scale += (int)((bits >> 52) & 0x7ff) - 1023;
+    x = s21_bits_double((bits & 0x000fffffffffffffULL) | 0x3ff0000000000000);
+  }
 
   for (; x >= S21_EXP; ex_pow++) {
     x = x / S21_EXP;
@@ -189,17 +212,67 @@ long double s21_log(
 
   for (int i = 0; i < 100; i++) {
     long double comp = result;
-    result = comp + 2 * (x - s21_exp(comp)) / (x + s21_exp(comp));
+    long double e = s21_exp_kernel(comp);
+    result = comp + 2 * (x - e) / (x + e);
   }
 
-  return (result + ex_pow);
+  result += ex_pow + scale * S21_LN2;
+  s21_memo_store(S21_MEMO_LOG, arg, 0, result);
+  return result;
+}
+
+long double s21_log1p(double x) {
+  long double result;
+  if (x != x || x < -1) {
+    result = S21_NAN;
+  } else if (x == -1) {
+    result = S21_INF_NEG;
+  } else if (x == S21_INF) {
+    result = S21_INF;
+  } else {
+    result = s21_log1p_kernel(x);
+  }
+  return result;
+}
+
+long double s21_log2(double x) {
+  long double result;
+  if (x != x || x < 0) {
+    result = S21_NAN;
+  } else if (x == 0) {
+    result = S21_INF_NEG;
+  } else if (x == S21_INF) {
+    result = S21_INF;
+  } else {
+    int e;
+    long double m = s21_log_kernel(x, &e);
+    result = e + m * S21_LOG2E;
+  }
+  return result;
+}
+
+long double s21_log10(double x) {
+  long double result;
+  if (x != x || x < 0) {
+    result = S21_NAN;
+  } else if (x == 0) {
+    result = S21_INF_NEG;
+  } else if (x == S21_INF) {
+    result = S21_INF;
+  } else {
+    int e;
+    long double m = s21_log_kernel(x, &e);
+    result = e * S21_LOG10_2 + m * S21_LOG10E;
+  }
+  return result;
 }
 
 long double s21_pow(double base, double exp) {
   long double result = 0;
   if (s21_fabs(base) < S21_EPS) base = 0;
 
-  if (!edge_pow(base, exp, &result)) {
+  if (!edge_pow(base, exp, &result) &&
+      !s21_memo_find(S21_MEMO_POW, base, exp, &result)) {
     if (exp == (int)exp) {
       result = s21_int_pow(base, exp);
     } else {
@@ -213,31 +286,61 @@ long double s21_pow(double base, double exp) {
       if (exp < 0) result = 1 / result;
       result *= sign;
     }
+    s21_memo_store(S21_MEMO_POW, base, exp, result);
   }
 
   return result;
 }
 
-long double s21_sin(double x) {
-  long double result = 0;
-  if (x != x) {
+long double s21_rsqrt(double x) {
+  long double result;
+  if (x != x || x < 0) {
     result = S21_NAN;
-  } else if (x == S21_INF || x == -S21_INF) {
+  } else if (x == 0) {
+    result = S21_INF;
+  } else if (x == S21_INF) {
+    result = 0;
+  } else {
+    result = 1.0L / s21_sqrt_kernel(x);
+  }
+  return result;
+}
+
+long double s21_rsqrt_fast(double x) {
+  long double result;
+  if (x != x || x < 0) {
     result = S21_NAN;
+  } else if (x == 0) {
+    result = S21_INF;
+  } else if (x == S21_INF) {
+    result = 0;
   } else {
-    long double x1 = s21_fmod(x, 2 * S21_PI);
-    long double temp = x1;
-    int i = 0;
-    while (s21_fabs(temp) >= S21_EPS) {
-      result += temp;
-      i++;
-      temp *= -x1 * x1 / (2 * i * (2 * i + 1));
-    }
+    int scale;
+    double m = s21_prescale(x, &scale);
+    result = s21_scale2(s21_rsqrt_fast_kernel(m), -scale / 2);
   }
   return result;
 }
 
-long double s21_sqrt(double x) { return s21_pow(x, 0.5); }
+long double s21_sin(double x) { return s21_sinl(x); }
+
+long double s21_sqrt(double x) {
+  long double result;
+  // ноль определяется по битам: с DAZ x == 0 истинно и для денормализованных
+  // x; в режиме S21_FTZ_DAZ они сами заменяются нулём того же знака
+  uint64_t bits = s21_double_bits(x);
+  int tiny = (bits & 0x7ff0000000000000ULL) == 0;
+  if (tiny && ((bits << 1) == 0 || s21_fp_mode_get() == S21_FTZ_DAZ)) {
+    result = bits >> 63 ? -0.0L : 0.0L;
+  } else if (x != x || x < 0) {
+    result = S21_NAN;
+  } else if (x == S21_INF) {
+    result = x;
+  } else {
+    result = s21_sqrt_kernel(x);
+  }
+  return result;
+}
 
 long double s21_tan(double x) {
   long double result = 0.0;
@@ -252,3 +355,119 @@ long double s21_tan(double x) {
   }
   return result;
 }
+
+long double s21_tgamma(double x) {
+  long double result;
+  if (x != x || x == S21_INF) {
+    result = x;
+  } else if (x == 0) {
+    result = 1 / x;
+  } else if (x == S21_INF_NEG || (x < 0 && s21_sinpi_kernel(x) == 0)) {
+    result = S21_NAN;
+  } else if (x > 171.7) {
+    result = S21_INF;
+  } else if (!s21_memo_find(S21_MEMO_TGAMMA, x, 0, &result)) {
+    result = s21_tgamma_kernel(x);
+    s21_memo_store(S21_MEMO_TGAMMA, x, 0, result);
+  }
+  return result;
+}
+
+// Версии для long double: аргумент не сужается до double
+
+long double s21_atanl(long double x) {
+  long double result;
+  if (x != x) {
+    result = x;
+  } else if (S21_IS_INF(x)) {
+    result = x < 0 ? -S21_PI_L / 2 : S21_PI_L / 2;
+  } else {
+    result = s21_atan_kernel(s21_fabsl(x));
+    if (x < 0) result = -result;
+  }
+  return result;
+}
+
+long double s21_ceill(long double x) {
+  long double result = x;
+  if (s21_fabsl(x) < 9e18L) {
+    result = (long double)(int64_t)x;
+    if (result < x) result += 1;
+  }
+  return result;
+}
+
+long double s21_cosl(long double x) {
+  long double result;
+  if (x != x || S21_IS_INF(x)) {
+    result = S21_NAN;
+  } else {
+    long double r;
+    int q = s21_rem_pio2(x, &r);
+    result = q % 2 ? s21_sin_kernel(r) : s21_cos_kernel(r);
+    if (q == 1 || q == 2) result = -result;
+  }
+  return result;
+}
+
+long double s21_expl(long double x) { return s21_exp_kernel(x); }
+
+long double s21_exp2l(long double x) { return s21_exp2_kernel(x); }
+
+long double s21_fabsl(long double x) { return x < 0 ? -x : x; }
+
+long double s21_floorl(long double x) {
+  long double result = x;
+  if (s21_fabsl(x) < 9e18L) {
+    result = (long double)(int64_t)x;
+    if (result > x) result -= 1;
+  }
+  return result;
+}
+
+long double s21_logl(long double x) { return s21_log_scaled(x, S21_LN2, 1); }
+
+long double s21_log2l(long double x) {
+  return s21_log_scaled(x, 1, S21_LOG2E);
+}
+
+long double s21_log10l(long double x) {
+  return s21_log_scaled(x, S21_LOG10_2, S21_LOG10E);
+}
+
+long double s21_sinl(long double x) {
+  long double result;
+  if (x != x || S21_IS_INF(x)) {
+    result = S21_NAN;
+  } else {
+    long double r;
+    int q = s21_rem_pio2(x, &r);
+    result = q % 2 ? s21_cos_kernel(r) : s21_sin_kernel(r);
+    if (q >= 2) result = -result;
+  }
+  return result;
+}
+
+// шаг Ньютона от корня в double
+long double s21_sqrtl(long double x) {
+  long double result;
+  if (x != x || x < 0) {
+    result = S21_NAN;
+  } else if (x == 0 || x == S21_INF) {
+    result = x;
+  } else {
+    long double y = s21_sqrt_kernel((double)x);
+    result = (y + x / y) / 2;
+  }
+  return result;
+}
+
+long double s21_tanl(long double x) {
+  long double result;
+  if (x != x || S21_IS_INF(x)) {
+    result = S21_NAN;
+  } else {
+    result = s21_sinl(x) / s21_cosl(x);
+  }
+  return result;
+}
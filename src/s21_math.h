@@ -1,6 +1,9 @@
 #ifndef S21_MATH_H
 #define S21_MATH_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #define S21_EPS 1e-15
 #define S21_MAX 1.7976931348623157e308
 #define S21_INF 1.0 / 0.0
@@ -8,6 +11,12 @@
 #define S21_NAN 0.0 / 0.0
 #define S21_EXP 2.71828182845904523536028747
 #define S21_PI 3.14159265358979323846
+#define S21_LN2 0.693147180559945309417232L
+#define S21_LN10 2.302585092994045684017991L
+#define S21_LOG2E 1.442695040888963407359925L
+#define S21_LOG10E 0.434294481903251827651129L
+#define S21_LOG10_2 0.301029995663981195213739L
+#define S21_DBL_MIN 2.2250738585072014e-308
 #define S21_IS_NAN(x) (x != x)
 #define S21_IS_INF(x) (x == S21_INF_NEG || x == S21_INF)
 
@@ -15,16 +24,510 @@ int s21_abs(int x);
 long double s21_acos(double x);
 long double s21_asin(double x);
 long double s21_atan(double x);
+long double s21_cbrt(double x);
 long double s21_ceil(double x);
 long double s21_cos(double x);
+long double s21_erf(double x);
+long double s21_erfc(double x);
 long double s21_exp(double x);
+long double s21_exp2(double x);
+long double s21_exp10(double x);
+long double s21_expm1(double x);
 long double s21_fabs(double x);
 long double s21_floor(double x);
 long double s21_fmod(double x, double y);
+long double s21_lgamma(double x);
 long double s21_log(double x);
+long double s21_log1p(double x);
+long double s21_log2(double x);
+long double s21_log10(double x);
 long double s21_pow(double base, double exp);
+long double s21_rsqrt(double x);
+long double s21_rsqrt_fast(double x);
 long double s21_sin(double x);
 long double s21_sqrt(double x);
 long double s21_tan(double x);
+long double s21_tgamma(double x);
+
+// Версии для float (суффикс f) и long double (суффикс l). Float-версии
+// считают в double короткими многочленами; long double-версии не сужают
+// аргумент, но его диапазон ограничен диапазоном double. Выбор версии по
+// типу аргумента — макросы s21_tgmath.h.
+float s21_atanf(float x);
+float s21_ceilf(float x);
+float s21_cosf(float x);
+float s21_expf(float x);
+float s21_exp2f(float x);
+float s21_fabsf(float x);
+float s21_floorf(float x);
+float s21_logf(float x);
+float s21_log2f(float x);
+float s21_log10f(float x);
+float s21_sinf(float x);
+float s21_sqrtf(float x);
+float s21_tanf(float x);
+long double s21_atanl(long double x);
+long double s21_ceill(long double x);
+long double s21_cosl(long double x);
+long double s21_expl(long double x);
+long double s21_exp2l(long double x);
+long double s21_fabsl(long double x);
+long double s21_floorl(long double x);
+long double s21_logl(long double x);
+long double s21_log2l(long double x);
+long double s21_log10l(long double x);
+long double s21_sinl(long double x);
+long double s21_sqrtl(long double x);
+long double s21_tanl(long double x);
+
+// Пакетные версии: res[i] = f(x[i]), i = 0..n-1
+void s21_acos_n(const double *x, double *res, size_t n);
+void s21_asin_n(const double *x, double *res, size_t n);
+void s21_atan_n(const double *x, double *res, size_t n);
+void s21_cbrt_n(const double *x, double *res, size_t n);
+void s21_ceil_n(const double *x, double *res, size_t n);
+void s21_cos_n(const double *x, double *res, size_t n);
+void s21_erf_n(const double *x, double *res, size_t n);
+void s21_erfc_n(const double *x, double *res, size_t n);
+void s21_exp_n(const double *x, double *res, size_t n);
+void s21_exp2_n(const double *x, double *res, size_t n);
+void s21_exp10_n(const double *x, double *res, size_t n);
+void s21_expm1_n(const double *x, double *res, size_t n);
+void s21_fabs_n(const double *x, double *res, size_t n);
+void s21_floor_n(const double *x, double *res, size_t n);
+void s21_lgamma_n(const double *x, double *res, size_t n);
+void s21_log_n(const double *x, double *res, size_t n);
+void s21_log1p_n(const double *x, double *res, size_t n);
+void s21_log2_n(const double *x, double *res, size_t n);
+void s21_log10_n(const double *x, double *res, size_t n);
+void s21_rsqrt_n(const double *x, double *res, size_t n);
+void s21_rsqrt_fast_n(const double *x, double *res, size_t n);
+void s21_sin_n(const double *x, double *res, size_t n);
+void s21_sqrt_n(const double *x, double *res, size_t n);
+void s21_tan_n(const double *x, double *res, size_t n);
+void s21_tgamma_n(const double *x, double *res, size_t n);
+void s21_fmod_n(const double *x, const double *y, double *res, size_t n);
+void s21_pow_n(const double *base, const double *exp, double *res, size_t n);
+
+// Комплексные функции над double _Complex (тот же тип, что double complex из
+// <complex.h>; сам заголовок не подключается, чтобы не вносить макрос I).
+// Пакетные версии работают с раздельными массивами действительных и мнимых
+// частей: res_re[i] + i res_im[i] = f(re[i] + i im[i]).
+long double s21_cabs(double _Complex z);
+long double s21_carg(double _Complex z);
+double _Complex s21_ccos(double _Complex z);
+double _Complex s21_cexp(double _Complex z);
+double _Complex s21_clog(double _Complex z);
+double _Complex s21_cpow(double _Complex z, double _Complex w);
+double _Complex s21_csin(double _Complex z);
+double _Complex s21_csqrt(double _Complex z);
+
+void s21_cabs_n(const double *re, const double *im, double *res, size_t n);
+void s21_carg_n(const double *re, const double *im, double *res, size_t n);
+void s21_ccos_n(const double *re, const double *im, double *res_re,
+                double *res_im, size_t n);
+void s21_cexp_n(const double *re, const double *im, double *res_re,
+                double *res_im, size_t n);
+void s21_clog_n(const double *re, const double *im, double *res_re,
+                double *res_im, size_t n);
+void s21_cpow_n(const double *re, const double *im, const double *w_re,
+                const double *w_im, double *res_re, double *res_im,
+                size_t n);
+void s21_csin_n(const double *re, const double *im, double *res_re,
+                double *res_im, size_t n);
+void s21_csqrt_n(const double *re, const double *im, double *res_re,
+                 double *res_im, size_t n);
+
+// Классификация и очистка входных массивов. Классы определяются по битам,
+// s21_classify_n возвращает объединение S21_FP_BIT(класс) по всем элементам
+// и S21_FP_NEGATIVE, если есть элементы со знаковым битом (cls может быть
+// NULL). Маска, равная S21_FP_BIT(S21_FP_NORMAL), означает, что блок можно
+// отдавать ядрам без проверок особых значений.
+typedef enum {
+  S21_FP_NAN,
+  S21_FP_INFINITE,
+  S21_FP_ZERO,
+  S21_FP_SUBNORMAL,
+  S21_FP_NORMAL
+} s21_fp_class;
+
+#define S21_FP_BIT(c) (1u << (c))
+#define S21_FP_NEGATIVE (1u << 5)
+#define S21_FP_FINITE                                       \
+  (S21_FP_BIT(S21_FP_ZERO) | S21_FP_BIT(S21_FP_SUBNORMAL) | \
+   S21_FP_BIT(S21_FP_NORMAL) | S21_FP_NEGATIVE)
+
+// Значения из классов replace (NaN, бесконечности, субнормальные)
+// заменяются на заданные, затем всё, кроме NaN, прижимается к [lo, hi]
+// (±S21_INF — без прижатия). in-place (x == res) допустим.
+typedef struct {
+  unsigned replace;  // маска S21_FP_BIT(...)
+  double nan;
+  double pos_inf, neg_inf;
+  double subnormal;
+  double lo, hi;
+} s21_sanitize_opts;
+
+s21_fp_class s21_classify(double x);
+unsigned s21_classify_n(const double *x, unsigned char *cls, size_t n);
+size_t s21_count_nonfinite_n(const double *x, size_t n);
+// возвращает число изменённых элементов
+size_t s21_sanitize_n(const double *x, double *res, size_t n,
+                      const s21_sanitize_opts *opts);
+
+// Версии с шагом в стиле BLAS: out[i * incy] = f(in[i * incx]). Данные
+// собираются блоками во внутренний буфер, поэтому in == out при
+// incx == incy допустимо.
+void s21_acos_strided(const double *in, ptrdiff_t incx, double *out,
+                      ptrdiff_t incy, size_t n);
+void s21_asin_strided(const double *in, ptrdiff_t incx, double *out,
+                      ptrdiff_t incy, size_t n);
+void s21_atan_strided(const double *in, ptrdiff_t incx, double *out,
+                      ptrdiff_t incy, size_t n);
+void s21_cbrt_strided(const double *in, ptrdiff_t incx, double *out,
+                      ptrdiff_t incy, size_t n);
+void s21_ceil_strided(const double *in, ptrdiff_t incx, double *out,
+                      ptrdiff_t incy, size_t n);
+void s21_cos_strided(const double *in, ptrdiff_t incx, double *out,
+                     ptrdiff_t incy, size_t n);
+void s21_erf_strided(const double *in, ptrdiff_t incx, double *out,
+                     ptrdiff_t incy, size_t n);
+void s21_erfc_strided(const double *in, ptrdiff_t incx, double *out,
+                      ptrdiff_t incy, size_t n);
+void s21_exp_strided(const double *in, ptrdiff_t incx, double *out,
+                     ptrdiff_t incy, size_t n);
+void s21_exp2_strided(const double *in, ptrdiff_t incx, double *out,
+                      ptrdiff_t incy, size_t n);
+void s21_exp10_strided(const double *in, ptrdiff_t incx, double *out,
+                       ptrdiff_t incy, size_t n);
+void s21_expm1_strided(const double *in, ptrdiff_t incx, double *out,
+                       ptrdiff_t incy, size_t n);
+void s21_fabs_strided(const double *in, ptrdiff_t incx, double *out,
+                      ptrdiff_t incy, size_t n);
+void s21_floor_strided(const double *in, ptrdiff_t incx, double *out,
+                       ptrdiff_t incy, size_t n);
+void s21_lgamma_strided(const double *in, ptrdiff_t incx, double *out,
+                        ptrdiff_t incy, size_t n);
+void s21_log_strided(const double *in, ptrdiff_t incx, double *out,
+                     ptrdiff_t incy, size_t n);
+void s21_log1p_strided(const double *in, ptrdiff_t incx, double *out,
+                       ptrdiff_t incy, size_t n);
+void s21_log2_strided(const double *in, ptrdiff_t incx, double *out,
+                      ptrdiff_t incy, size_t n);
+void s21_log10_strided(const double *in, ptrdiff_t incx, double *out,
+                       ptrdiff_t incy, size_t n);
+void s21_rsqrt_strided(const double *in, ptrdiff_t incx, double *out,
+                       ptrdiff_t incy, size_t n);
+void s21_rsqrt_fast_strided(const double *in, ptrdiff_t incx, double *out,
+                            ptrdiff_t incy, size_t n);
+void s21_sin_strided(const double *in, ptrdiff_t incx, double *out,
+                     ptrdiff_t incy, size_t n);
+void s21_sqrt_strided(const double *in, ptrdiff_t incx, double *out,
+                      ptrdiff_t incy, size_t n);
+void s21_tan_strided(const double *in, ptrdiff_t incx, double *out,
+                     ptrdiff_t incy, size_t n);
+void s21_tgamma_strided(const double *in, ptrdiff_t incx, double *out,
+                        ptrdiff_t incy, size_t n);
+void s21_fmod_strided(const double *x, ptrdiff_t incx, const double *y,
+                      ptrdiff_t incy, double *out, ptrdiff_t incz, size_t n);
+void s21_pow_strided(const double *base, ptrdiff_t incb, const double *exp,
+                     ptrdiff_t ince, double *out, ptrdiff_t incz, size_t n);
+
+// Целочисленные версии в фиксированной точке (без операций с плавающей
+// точкой). Угол в Q1.15 задаётся в единицах pi: [-32768, 32767] — [-pi, pi).
+// Погрешности относительно s21_sin/s21_cos/s21_atan/s21_exp/s21_sqrt:
+//   s21_sin_q15, s21_cos_q15 — не более 1.1 младшего разряда (3.4e-5);
+//   s21_atan2_q15            — не более 1 младшего разряда угла;
+//   s21_exp_q16              — относительная 1e-8 либо 1 младший разряд,
+//                              насыщение до INT32_MAX при x > ln(32768);
+//   s21_sqrt_q16             — округление к ближайшему, 0 для x < 0.
+int16_t s21_sin_q15(int16_t x);
+int16_t s21_cos_q15(int16_t x);
+int16_t s21_atan2_q15(int16_t y, int16_t x);
+int32_t s21_exp_q16(int32_t x);
+int32_t s21_sqrt_q16(int32_t x);
+
+void s21_sin_q15_n(const int16_t *x, int16_t *res, size_t n);
+void s21_cos_q15_n(const int16_t *x, int16_t *res, size_t n);
+void s21_atan2_q15_n(const int16_t *y, const int16_t *x, int16_t *res,
+                     size_t n);
+void s21_exp_q16_n(const int32_t *x, int32_t *res, size_t n);
+void s21_sqrt_q16_n(const int32_t *x, int32_t *res, size_t n);
+
+// Пакетные версии для буферов fp16 (IEEE binary16) и bfloat16. Вычисления
+// ведутся во float, результат округляется к ближайшему представимому.
+float s21_f16_to_float(uint16_t h);
+uint16_t s21_float_to_f16(float f);
+float s21_bf16_to_float(uint16_t h);
+uint16_t s21_float_to_bf16(float f);
+
+void s21_exp_f16_n(const uint16_t *x, uint16_t *res, size_t n);
+void s21_log_f16_n(const uint16_t *x, uint16_t *res, size_t n);
+void s21_tanh_f16_n(const uint16_t *x, uint16_t *res, size_t n);
+void s21_exp_bf16_n(const uint16_t *x, uint16_t *res, size_t n);
+void s21_log_bf16_n(const uint16_t *x, uint16_t *res, size_t n);
+void s21_tanh_bf16_n(const uint16_t *x, uint16_t *res, size_t n);
+
+// Приближённый режим по таблице (включается явно). Таблица строится один раз
+// для f на [a, b] из size узлов; за пределами отрезка аргумент прижимается
+// к его границам. s21_lut_max_error — оценка максимальной абсолютной
+// погрешности, s21_lut_memory — занимаемая память в байтах.
+typedef enum {
+  S21_LUT_NEAREST,
+  S21_LUT_LINEAR,
+  S21_LUT_CUBIC
+} s21_lut_interp;
+
+typedef struct s21_lut s21_lut;
+
+s21_lut *s21_lut_create(long double (*f)(double), double a, double b,
+                        size_t size, s21_lut_interp interp);
+void s21_lut_free(s21_lut *lut);
+double s21_lut_eval(const s21_lut *lut, double x);
+void s21_lut_eval_n(const s21_lut *lut, const double *x, double *res,
+                    size_t n);
+double s21_lut_max_error(const s21_lut *lut);
+size_t s21_lut_memory(const s21_lut *lut);
+
+// Многочлен c[0] + c[1] x + ... + c[degree] x^degree и отношение двух
+// многочленов. S21_POLY_HORNER — наименьшее число операций,
+// S21_POLY_ESTRIN — короткая цепочка зависимостей для конвейера и
+// больших степеней, S21_POLY_FMA — Горнер с одним округлением на шаг.
+// Пакетные формы дают те же значения, что и скалярные.
+typedef enum { S21_POLY_HORNER, S21_POLY_ESTRIN, S21_POLY_FMA } s21_poly_scheme;
+
+double s21_polyval(const double *c, int degree, double x,
+                   s21_poly_scheme scheme);
+void s21_polyval_n(const double *c, int degree, const double *x, double *res,
+                   size_t n, s21_poly_scheme scheme);
+double s21_ratval(const double *p, int pdeg, const double *q, int qdeg,
+                  double x, s21_poly_scheme scheme);
+void s21_ratval_n(const double *p, int pdeg, const double *q, int qdeg,
+                  const double *x, double *res, size_t n,
+                  s21_poly_scheme scheme);
+
+// Кусочно-чебышёвское приближение f на [a, b] с абсолютной погрешностью
+// tol и степенью не выше max_degree (1..16); отрезок делится пополам, пока
+// допуск не выполнен (не больше 4096 частей). s21_cheb_max_error —
+// достигнутая погрешность, она может превышать tol, если допуск
+// недостижим. s21_cheb_save пишет приближение в buf и возвращает нужный
+// размер (при нехватке места ничего не пишет), s21_cheb_load
+// восстанавливает его на машине с тем же порядком байтов.
+typedef struct s21_cheb s21_cheb;
+
+s21_cheb *s21_cheb_create(long double (*f)(double), double a, double b,
+                          double tol, int max_degree);
+void s21_cheb_free(s21_cheb *c);
+double s21_cheb_eval(const s21_cheb *c, double x);
+void s21_cheb_eval_n(const s21_cheb *c, const double *x, double *res,
+                     size_t n);
+double s21_cheb_max_error(const s21_cheb *c);
+int s21_cheb_degree(const s21_cheb *c);
+size_t s21_cheb_segments(const s21_cheb *c);
+size_t s21_cheb_memory(const s21_cheb *c);
+size_t s21_cheb_save(const s21_cheb *c, void *buf, size_t size);
+s21_cheb *s21_cheb_load(const void *buf, size_t size);
+
+// Число потоков для пакетных редукций (по умолчанию 1, 0 — все ядра).
+// Результат не зависит от числа потоков. Рабочие потоки создаются один раз
+// и переиспользуются; менять число можно из любого потока.
+void s21_set_threads(int n);
+int s21_get_threads(void);
+
+// fn(ctx, номер куска, начало, конец) для кусков [0, n) размера chunk_size,
+// распределённых по s21_get_threads() потокам; куски с одним номером
+// одинаковы при любом числе потоков
+typedef void (*s21_chunk_fn)(void *ctx, size_t chunk, size_t begin,
+                             size_t end);
+size_t s21_chunk_count(size_t n, size_t chunk_size);
+void s21_parallel_chunks(size_t n, size_t chunk_size, s21_chunk_fn fn,
+                         void *ctx);
+
+// Устойчивые редукции за один проход без промежуточных массивов:
+// ln(sum e^x[i]), sum e^x[i] и softmax (res может совпадать с x)
+long double s21_logsumexp(const double *x, size_t n);
+long double s21_sum_exp(const double *x, size_t n);
+void s21_softmax(const double *x, double *res, size_t n);
+
+// Суммирование, скалярное произведение и евклидова норма. Компенсированный
+// режим даёт результат как при удвоенной точности накопления, быстрый —
+// обычное суммирование в несколько независимых аккумуляторов. Без FMA
+// компенсированное произведение рассчитано на |x[i]|, |y[i]| < 1e300.
+typedef enum { S21_SUM_FAST, S21_SUM_COMPENSATED } s21_sum_mode;
+
+long double s21_fsum(const double *x, size_t n, s21_sum_mode mode);
+long double s21_dot(const double *x, const double *y, size_t n,
+                    s21_sum_mode mode);
+long double s21_norm2(const double *x, size_t n, s21_sum_mode mode);
+
+// Генератор Philox4x32-10 со счётчиком. Потоки с разными stream при одном
+// seed независимы; каждый вызов продолжает последовательность с места, где
+// остановился предыдущий (значения идут парами, при нечётном n второе
+// значение последней пары пропускается). Большие пакеты заполняются в
+// s21_get_threads() потоков с тем же результатом.
+typedef struct {
+  uint64_t seed;
+  uint64_t stream;
+  uint64_t counter;  // номер следующей пары
+} s21_rng;
+
+void s21_philox4x32(const uint32_t ctr[4], const uint32_t key[2],
+                    uint32_t out[4]);
+void s21_rng_init(s21_rng *rng, uint64_t seed, uint64_t stream);
+void s21_rand_n(s21_rng *rng, double *res, size_t n);   // равномерное (0, 1)
+void s21_randn_n(s21_rng *rng, double *res, size_t n);  // N(0, 1)
+void s21_rande_n(s21_rng *rng, double *res, size_t n);  // Exp(1)
+
+// Автонастройка пакетных функций с несколькими реализациями. s21_tune
+// замеряет на этой машине все реализации, укладывающиеся в бюджет
+// (максимум ULP от эталонной), и назначает самые быстрые; при path != NULL
+// выбор сохраняется в файл, помеченный моделью процессора, и
+// s21_tune_load восстанавливает его без замеров. Если задана переменная
+// окружения S21_TUNE_CACHE, первый вызов загружает этот файл или, при
+// другом процессоре, настраивается и перезаписывает его. До настройки
+// действуют исходные реализации. Выбор меняется только между вызовами
+// функций, а не параллельно с ними.
+typedef enum {
+  S21_TUNE_COS,
+  S21_TUNE_EXP,
+  S21_TUNE_LOG,
+  S21_TUNE_RSQRT,
+  S21_TUNE_SIN,
+  S21_TUNE_SQRT,
+  S21_TUNE_COUNT
+} s21_tune_fn;
+
+int s21_tune(const char *path);       // 0 — успех, -1 — файл не записан
+int s21_tune_load(const char *path);  // 0 — загружено, -1 — нет или чужой
+void s21_tune_set_budget(s21_tune_fn fn, double max_ulp);
+double s21_tune_get_budget(s21_tune_fn fn);
+const char *s21_tune_get(s21_tune_fn fn);           // имя текущей реализации
+int s21_tune_set(s21_tune_fn fn, const char *name);  // -1 — нет такой
+// имена реализаций через пробел, первая — эталон
+const char *s21_tune_candidates(s21_tune_fn fn);
+const char *s21_tune_cpu(void);  // ключ файла настройки
+
+// Асинхронная очередь пакетных вычислений. s21_async_submit кладёт задание
+// res[i] = fn(x[i]) (для S21_ASYNC_POW — pow(x[i], y[i])) в кольцо без
+// блокировок и сразу возвращает дескриптор; буферы должны жить до
+// завершения. Рабочие потоки очереди снимают мелкие задания пачками до
+// batch элементов. Если кольцо заполнено или в очереди и в работе больше
+// max_pending элементов, возвращается NULL с errno = EAGAIN. Завершение
+// проверяется s21_async_poll, ожидается s21_async_wait; дескриптор
+// освобождает s21_async_release (ждёт завершения). На Linux каждое
+// завершение прибавляет 1 к счётчику s21_async_eventfd (иначе -1).
+typedef enum {
+  S21_ASYNC_COS,
+  S21_ASYNC_EXP,
+  S21_ASYNC_EXP2,
+  S21_ASYNC_EXPM1,
+  S21_ASYNC_LOG,
+  S21_ASYNC_LOG1P,
+  S21_ASYNC_LOG2,
+  S21_ASYNC_LOG10,
+  S21_ASYNC_POW,
+  S21_ASYNC_RSQRT,
+  S21_ASYNC_SIN,
+  S21_ASYNC_SQRT,
+  S21_ASYNC_TAN,
+  S21_ASYNC_COUNT
+} s21_async_fn;
+
+typedef struct {
+  int workers;         // рабочих потоков, по умолчанию 1
+  size_t capacity;     // мест в кольце, до степени двойки (0 — 1024)
+  size_t max_pending;  // предел элементов (0 — без предела)
+  size_t batch;        // элементов за один заход рабочего (0 — 65536)
+} s21_async_config;
+
+// времена в секундах: обслуживание — выполнение, задержка — от отправки
+typedef struct {
+  size_t submitted, completed, rejected;
+  size_t batches;    // заходов рабочих
+  size_t depth;      // заданий в кольце сейчас
+  size_t max_depth;  // наибольшая глубина при отправке
+  size_t pending;    // элементов в очереди и в работе
+  double service_time, max_service_time;
+  double latency, max_latency;
+} s21_async_stats;
+
+typedef struct s21_async_queue s21_async_queue;
+typedef struct s21_async_job s21_async_job;
+
+// cfg = NULL — настройки по умолчанию
+s21_async_queue *s21_async_create(const s21_async_config *cfg);
+void s21_async_destroy(s21_async_queue *q);  // дожидается всех заданий
+s21_async_job *s21_async_submit(s21_async_queue *q, s21_async_fn fn,
+                                const double *x, const double *y, double *res,
+                                size_t n);
+int s21_async_poll(const s21_async_job *job);  // 1 — готово
+void s21_async_wait(s21_async_queue *q, const s21_async_job *job);
+void s21_async_release(s21_async_queue *q, s21_async_job *job);
+int s21_async_eventfd(const s21_async_queue *q);
+void s21_async_pause(s21_async_queue *q);  // рабочие не берут новые задания
+void s21_async_resume(s21_async_queue *q);
+void s21_async_get_stats(s21_async_queue *q, s21_async_stats *stats);
+
+// Режим денормализованных чисел в текущем потоке. S21_FTZ_DAZ включает в
+// MXCSR флаги FTZ (денормализованный результат заменяется нулём) и DAZ
+// (денормализованный вход считается нулём) до парного s21_fp_mode_pop.
+// Куски s21_set_threads и задания s21_async выполняются в режиме
+// отправившего их потока. Пакетные exp, exp2 и exp10 в этом режиме
+// возвращают 0 вместо результатов меньше S21_DBL_MIN. Без SSE режим только
+// запоминается.
+// Вложенность — до 16; сверх неё push возвращает -1 и режим не меняет.
+typedef enum { S21_FP_STRICT, S21_FTZ_DAZ } s21_fp_mode;
+
+int s21_fp_mode_push(s21_fp_mode mode);
+void s21_fp_mode_pop(void);
+s21_fp_mode s21_fp_mode_get(void);
+
+// Значения на прогрессии: s[k] = sin(x0 + k dx), c[k] = cos(x0 + k dx)
+// (s или c может быть NULL), res[k] = e^(a0 + k da), k = 0..n-1. Соседние
+// точки получаются поворотом или умножением, каждые 16 шагов точка
+// считается заново, так что ошибка не накапливается по всей длине.
+void s21_sincos_ramp(double x0, double dx, double *s, double *c, size_t n);
+void s21_exp_ramp(double a0, double da, double *res, size_t n);
+
+// Кэш результатов для повторяющихся аргументов, отдельный у каждого потока
+// и включаемый для каждой функции отдельно: s21_memo_enable заводит
+// таблицу прямого отображения на size ячеек (до степени двойки, 0 — 256,
+// не больше 2^20) и сбрасывает статистику, s21_memo_disable освобождает
+// её. 0 — успех, -1 — неверная функция или размер, нет памяти.
+typedef enum {
+  S21_MEMO_ACOS,
+  S21_MEMO_ASIN,
+  S21_MEMO_EXP,
+  S21_MEMO_LGAMMA,
+  S21_MEMO_LOG,
+  S21_MEMO_POW,
+  S21_MEMO_TGAMMA,
+  S21_MEMO_COUNT
+} s21_memo_fn;
+
+typedef struct {
+  size_t hits, misses;
+  size_t evictions;  // вытеснений другого аргумента
+  size_t size;       // ячеек, 0 — кэш выключен
+} s21_memo_stats;
+
+int s21_memo_enable(s21_memo_fn fn, size_t size);
+void s21_memo_disable(s21_memo_fn fn);
+void s21_memo_get_stats(s21_memo_fn fn, s21_memo_stats *stats);
+
+// Преобразования координат над массивами точек (раздельные массивы x и y
+// или r и theta; результат можно писать на место входа). Угол поворота в
+// s21_rotate2d_n один для всех точек, theta в (-pi, pi]. Матрицы 3x3 — по
+// строкам; кватернион (w, x, y, z) и ось нормируются, нулевые дают
+// единичную матрицу.
+void s21_rotate2d_n(double angle, const double *x, const double *y,
+                    double *res_x, double *res_y, size_t n);
+void s21_polar_to_cart_n(const double *r, const double *theta, double *x,
+                         double *y, size_t n);
+void s21_cart_to_polar_n(const double *x, const double *y, double *r,
+                         double *theta, size_t n);
+void s21_quat_to_matrix(const double q[4], double m[9]);
+void s21_axis_angle_to_matrix(const double axis[3], double angle,
+                              double m[9]);
 
-#endif
\ No newline at end of file
+#endif
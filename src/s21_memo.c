@@ -0,0 +1,119 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "s21_math.h"
+#include "utils.h"
+
+// Кэш прямого отображения у каждого потока свой, поэтому блокировок нет.
+// Ключ — биты аргументов; пустая ячейка помечена ключом NaN, а аргументы
+// NaN не кэшируются, так что с ней ничего не совпадает. Таблицы потока
+// освобождаются деструктором ключа pthread при его завершении.
+
+#define S21_MEMO_DEFAULT 256
+#define S21_MEMO_MAX (1u << 20)
+#define S21_MEMO_EMPTY 0x7ff8000000000000ULL
+
+typedef struct {
+  uint64_t a, b;
+  long double res;
+} s21_memo_slot;
+
+typedef struct {
+  s21_memo_slot *slots;
+  size_t mask;  // размер - 1
+  s21_memo_stats stats;
+} s21_memo_table;
+
+static _Thread_local s21_memo_table s21_memo_tables[S21_MEMO_COUNT];
+static _Thread_local unsigned s21_memo_on = 0;  // бит на функцию
+static pthread_key_t s21_memo_key;
+static pthread_once_t s21_memo_once = PTHREAD_ONCE_INIT;
+
+// вызывается при завершении потока; arg — его s21_memo_tables
+static void s21_memo_free_thread(void *arg) {
+  s21_memo_table *tables = arg;
+  for (int fn = 0; fn < S21_MEMO_COUNT; fn++) {
+    free(tables[fn].slots);
+    tables[fn].slots = NULL;
+  }
+}
+
+static void s21_memo_init_key(void) {
+  pthread_key_create(&s21_memo_key, s21_memo_free_thread);
+}
+
+static inline s21_memo_slot *s21_memo_slot_of(const s21_memo_table *t,
+                                              uint64_t a, uint64_t b) {
+  uint64_t h = (a ^ (b * 0xc2b2ae3d27d4eb4fULL)) * 0x9e3779b97f4a7c15ULL;
+  return &t->slots[(h >> 44) & t->mask];  // старшие 20 бит хеша
+}
+
+int s21_memo_enable(s21_memo_fn fn, size_t size) {
+  int status = 0;
+  s21_memo_slot *slots = NULL;
+  if ((unsigned int)fn >= S21_MEMO_COUNT || size > S21_MEMO_MAX) {
+    status = -1;
+  } else {
+    if (size == 0) size = S21_MEMO_DEFAULT;
+    size_t cap = 1;
+    while (cap < size) cap *= 2;
+    size = cap;
+    slots = malloc(size * sizeof(*slots));
+    if (slots == NULL) status = -1;
+  }
+  if (status == 0) {
+    for (size_t i = 0; i < size; i++) {
+      slots[i] = (s21_memo_slot){S21_MEMO_EMPTY, 0, 0};
+    }
+    pthread_once(&s21_memo_once, s21_memo_init_key);
+    pthread_setspecific(s21_memo_key, s21_memo_tables);
+    s21_memo_table *t = &s21_memo_tables[fn];
+    free(t->slots);
+    *t = (s21_memo_table){slots, size - 1, {0, 0, 0, size}};
+    s21_memo_on |= 1u << fn;
+  }
+  return status;
+}
+
+void s21_memo_disable(s21_memo_fn fn) {
+  if ((unsigned int)fn < S21_MEMO_COUNT) {
+    s21_memo_table *t = &s21_memo_tables[fn];
+    free(t->slots);
+    *t = (s21_memo_table){NULL, 0, {0, 0, 0, 0}};
+    s21_memo_on &= ~(1u << fn);
+  }
+}
+
+void s21_memo_get_stats(s21_memo_fn fn, s21_memo_stats *stats) {
+  *stats = (s21_memo_stats){0, 0, 0, 0};
+  if ((unsigned int)fn < S21_MEMO_COUNT) *stats = s21_memo_tables[fn].stats;
+}
+
+int s21_memo_find(s21_memo_fn fn, double a, double b, long double *res) {
+  int found = 0;
+  if (((s21_memo_on >> fn) & 1u) && a == a && b == b) {
+    s21_memo_table *t = &s21_memo_tables[fn];
+    uint64_t ka = s21_double_bits(a), kb = s21_double_bits(b);
+    const s21_memo_slot *slot = s21_memo_slot_of(t, ka, kb);
+    found = slot->a == ka && slot->b == kb;
+    if (found) {
+      *res = slot->res;
+      t->stats.hits++;
+    } else {
+      t->stats.misses++;
+    }
+  }
+  return found;
+}
+
+void s21_memo_store(s21_memo_fn fn, double a, double b, long double res) {
+  if (((s21_memo_on >> fn) & 1u) && a == a && b == b) {
+    s21_memo_table *t = &s21_memo_tables[fn];
+    uint64_t ka = s21_double_bits(a), kb = s21_double_bits(b);
+    s21_memo_slot *slot = s21_memo_slot_of(t, ka, kb);
+    if (slot->a != S21_MEMO_EMPTY) t->stats.evictions++;
+    *slot = (s21_memo_slot){ka, kb, res};
+  }
+}
@@ -0,0 +1,168 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "s21_math.h"
+#include "utils.h"
+
+// Разбиение на куски фиксированного размера не зависит от числа потоков:
+// поток t обрабатывает куски t, t + T, t + 2T, ..., а вызывающий код
+// сворачивает частичные результаты в порядке номеров кусков. Поэтому
+// результат редукций не зависит от того, сколько потоков было задано.
+//
+// Рабочие потоки создаются при первой потребности и живут до конца
+// процесса: вызов раздаёт им задания, увеличивая номер поколения, и ждёт,
+// пока все отчитаются. Пулом пользуется один вызов за раз; остальные (в
+// том числе вложенные из fn) выполняют все свои куски сами.
+
+#define S21_MAX_THREADS 64
+
+static atomic_int s21_threads = 1;
+
+typedef struct {
+  s21_chunk_fn fn;
+  void *ctx;
+  size_t n;
+  size_t chunk_size;
+  size_t chunks;
+  size_t first;
+  size_t step;
+  s21_fp_mode mode;  // режим вызывающего потока, MXCSR у потоков свой
+} s21_parallel_job;
+
+typedef struct {
+  pthread_mutex_t owner;  // захвачен вызовом, раздающим задания
+  pthread_mutex_t lock;   // защищает остальные поля
+  pthread_cond_t work;
+  pthread_cond_t done;
+  size_t workers;         // рабочие с номерами 1..workers
+  size_t active;          // рабочий i <= active выполняет jobs[i]
+  size_t pending;         // из них ещё не закончили
+  unsigned long generation;
+  unsigned long seen[S21_MAX_THREADS];  // последнее поколение рабочего
+  s21_parallel_job *jobs;
+} s21_pool;
+
+static s21_pool s21_the_pool = {.owner = PTHREAD_MUTEX_INITIALIZER,
+                                .lock = PTHREAD_MUTEX_INITIALIZER,
+                                .work = PTHREAD_COND_INITIALIZER,
+                                .done = PTHREAD_COND_INITIALIZER};
+static pthread_once_t s21_pool_once = PTHREAD_ONCE_INIT;
+
+void s21_set_threads(int n) {
+  if (n <= 0) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    n = cpus > 0 ? (int)cpus : 1;
+  }
+  atomic_store_explicit(&s21_threads, n > S21_MAX_THREADS ? S21_MAX_THREADS : n,
+                        memory_order_relaxed);
+}
+
+int s21_get_threads(void) {
+  return atomic_load_explicit(&s21_threads, memory_order_relaxed);
+}
+
+static void s21_parallel_run(const s21_parallel_job *job) {
+  int pushed = s21_fp_mode_push(job->mode) == 0;
+  for (size_t c = job->first; c < job->chunks; c += job->step) {
+    size_t begin = c * job->chunk_size;
+    size_t end = begin + job->chunk_size < job->n ? begin + job->chunk_size
+                                                  : job->n;
+    job->fn(job->ctx, c, begin, end);
+  }
+  if (pushed) s21_fp_mode_pop();
+}
+
+static void *s21_pool_worker(void *arg) {
+  s21_pool *p = &s21_the_pool;
+  size_t id = (size_t)(uintptr_t)arg;
+  pthread_mutex_lock(&p->lock);
+  for (;;) {
+    while (p->seen[id] == p->generation) pthread_cond_wait(&p->work, &p->lock);
+    p->seen[id] = p->generation;
+    if (id <= p->active) {
+      const s21_parallel_job *job = &p->jobs[id];
+      pthread_mutex_unlock(&p->lock);
+      s21_parallel_run(job);
+      pthread_mutex_lock(&p->lock);
+      if (--p->pending == 0) pthread_cond_signal(&p->done);
+    }
+  }
+  return NULL;
+}
+
+// в дочернем процессе после fork рабочих потоков нет
+static void s21_pool_after_fork(void) {
+  s21_pool *p = &s21_the_pool;
+  pthread_mutex_init(&p->owner, NULL);
+  pthread_mutex_init(&p->lock, NULL);
+  pthread_cond_init(&p->work, NULL);
+  pthread_cond_init(&p->done, NULL);
+  p->workers = 0;
+  p->active = 0;
+  p->pending = 0;
+}
+
+static void s21_pool_register(void) {
+  pthread_atfork(NULL, NULL, s21_pool_after_fork);
+}
+
+// под lock: число рабочих, не больше want
+static size_t s21_pool_grow(s21_pool *p, size_t want) {
+  pthread_once(&s21_pool_once, s21_pool_register);
+  while (p->workers < want) {
+    size_t id = p->workers + 1;
+    pthread_t tid;
+    p->seen[id] = p->generation;
+    if (pthread_create(&tid, NULL, s21_pool_worker, (void *)(uintptr_t)id) !=
+        0) {
+      break;
+    }
+    pthread_detach(tid);
+    p->workers = id;
+  }
+  return p->workers < want ? p->workers : want;
+}
+
+size_t s21_chunk_count(size_t n, size_t chunk_size) {
+  return (n + chunk_size - 1) / chunk_size;
+}
+
+void s21_parallel_chunks(size_t n, size_t chunk_size, s21_chunk_fn fn,
+                         void *ctx) {
+  s21_pool *p = &s21_the_pool;
+  size_t chunks = s21_chunk_count(n, chunk_size);
+  size_t threads = (size_t)s21_get_threads();
+  if (threads > chunks) threads = chunks;
+  if (threads == 0) threads = 1;
+  s21_parallel_job jobs[S21_MAX_THREADS];
+  s21_fp_mode mode = s21_fp_mode_get();
+  for (size_t t = 0; t < threads; t++) {
+    jobs[t] =
+        (s21_parallel_job){fn, ctx, n, chunk_size, chunks, t, threads, mode};
+  }
+  size_t helpers = 0;
+  int owner = threads > 1 && pthread_mutex_trylock(&p->owner) == 0;
+  if (owner) {
+    pthread_mutex_lock(&p->lock);
+    helpers = s21_pool_grow(p, threads - 1);
+    p->jobs = jobs;
+    p->active = helpers;
+    p->pending = helpers;
+    p->generation++;
+    pthread_cond_broadcast(&p->work);
+    pthread_mutex_unlock(&p->lock);
+  }
+  // куски, не доставшиеся рабочим пула, делает вызывающий поток
+  for (size_t t = helpers + 1; t < threads; t++) s21_parallel_run(&jobs[t]);
+  s21_parallel_run(&jobs[0]);
+  if (owner) {
+    pthread_mutex_lock(&p->lock);
+    while (p->pending > 0) pthread_cond_wait(&p->done, &p->lock);
+    pthread_mutex_unlock(&p->lock);
+    pthread_mutex_unlock(&p->owner);
+  }
+}
@@ -0,0 +1,190 @@
+#include "s21_math.h"
+#include "utils.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Многочлены фиксированной степени: Горнер (одна цепочка умножений и
+// сложений), Эстрин (пары c[2i] + c[2i+1] x складываются по степеням x^2,
+// x^4, ... — цепочка длины log2(степени)) и Горнер с FMA. Для степеней до 8
+// тело разворачивается компилятором; пакетные формы считают те же операции
+// в том же порядке по полосам SIMD, поэтому совпадают со скалярными
+// побитово. Выше S21_POLY_ESTRIN_MAX схема Эстрина заменяется Горнером.
+
+#define S21_POLY_ESTRIN_MAX 63
+
+#if defined(__AVX__)
+typedef __m256d s21_vd;
+#define S21_VL 4
+#define s21_vload _mm256_loadu_pd
+#define s21_vstore _mm256_storeu_pd
+#define s21_vset1 _mm256_set1_pd
+#define s21_vadd _mm256_add_pd
+#define s21_vmul _mm256_mul_pd
+#define s21_vdiv _mm256_div_pd
+#elif defined(__SSE2__)
+typedef __m128d s21_vd;
+#define S21_VL 2
+#define s21_vload _mm_loadu_pd
+#define s21_vstore _mm_storeu_pd
+#define s21_vset1 _mm_set1_pd
+#define s21_vadd _mm_add_pd
+#define s21_vmul _mm_mul_pd
+#define s21_vdiv _mm_div_pd
+#endif
+
+// a * b + c с одним округлением; без аппаратного FMA — через long double
+static inline double s21_fmadd(double a, double b, double c) {
+#if defined(__FMA__)
+  return __builtin_fma(a, b, c);
+#else
+  return (double)((long double)a * b + c);
+#endif
+}
+
+static inline double s21_horner(const double *c, int d, double x) {
+  double r = c[d];
+  for (int i = d - 1; i >= 0; i--) r = r * x + c[i];
+  return r;
+}
+
+static inline double s21_horner_fma(const double *c, int d, double x) {
+  double r = c[d];
+  for (int i = d - 1; i >= 0; i--) r = s21_fmadd(r, x, c[i]);
+  return r;
+}
+
+static inline double s21_estrin(const double *c, int d, double x) {
+  double t[S21_POLY_ESTRIN_MAX / 2 + 1];
+  int m = d / 2 + 1;
+  for (int i = 0; i < m; i++) {
+    t[i] = 2 * i + 1 <= d ? c[2 * i] + c[2 * i + 1] * x : c[2 * i];
+  }
+  for (double p = x * x; m > 1; p *= p) {
+    for (int i = 0; i < m / 2; i++) t[i] = t[2 * i] + t[2 * i + 1] * p;
+    if (m % 2) t[m / 2] = t[m - 1];
+    m = (m + 1) / 2;
+  }
+  return t[0];
+}
+
+// вызов с постоянной степенью, чтобы циклы развернулись
+#define S21_POLY_FIXED(fn, c, d, x) \
+  ((d) == 1   ? fn(c, 1, x)         \
+   : (d) == 2 ? fn(c, 2, x)         \
+   : (d) == 3 ? fn(c, 3, x)         \
+   : (d) == 4 ? fn(c, 4, x)         \
+   : (d) == 5 ? fn(c, 5, x)         \
+   : (d) == 6 ? fn(c, 6, x)         \
+   : (d) == 7 ? fn(c, 7, x)         \
+   : (d) == 8 ? fn(c, 8, x)         \
+              : fn(c, d, x))
+
+double s21_polyval(const double *c, int degree, double x,
+                   s21_poly_scheme scheme) {
+  double r;
+  if (degree < 0) {
+    r = 0;
+  } else if (degree == 0) {
+    r = c[0];
+  } else if (scheme == S21_POLY_FMA) {
+    r = S21_POLY_FIXED(s21_horner_fma, c, degree, x);
+  } else if (scheme == S21_POLY_ESTRIN && degree <= S21_POLY_ESTRIN_MAX) {
+    r = S21_POLY_FIXED(s21_estrin, c, degree, x);
+  } else {
+    r = S21_POLY_FIXED(s21_horner, c, degree, x);
+  }
+  return r;
+}
+
+double s21_ratval(const double *p, int pdeg, const double *q, int qdeg,
+                  double x, s21_poly_scheme scheme) {
+  return s21_polyval(p, pdeg, x, scheme) / s21_polyval(q, qdeg, x, scheme);
+}
+
+#if defined(S21_VL)
+static inline s21_vd s21_vfmadd(s21_vd a, s21_vd b, s21_vd c) {
+#if defined(__FMA__)
+  return _mm256_fmadd_pd(a, b, c);
+#else
+  return s21_vadd(s21_vmul(a, b), c);
+#endif
+}
+
+static s21_vd s21_vpoly(const double *c, int d, s21_vd x,
+                        s21_poly_scheme scheme) {
+  s21_vd r;
+  if (d < 0) {
+    r = s21_vset1(0);
+  } else if (scheme == S21_POLY_ESTRIN && d <= S21_POLY_ESTRIN_MAX) {
+    s21_vd t[S21_POLY_ESTRIN_MAX / 2 + 1];
+    int m = d / 2 + 1;
+    for (int i = 0; i < m; i++) {
+      t[i] = 2 * i + 1 <= d
+                 ? s21_vadd(s21_vset1(c[2 * i]),
+                            s21_vmul(s21_vset1(c[2 * i + 1]), x))
+                 : s21_vset1(c[2 * i]);
+    }
+    for (s21_vd p = s21_vmul(x, x); m > 1; p = s21_vmul(p, p)) {
+      for (int i = 0; i < m / 2; i++) {
+        t[i] = s21_vadd(t[2 * i], s21_vmul(t[2 * i + 1], p));
+      }
+      if (m % 2) t[m / 2] = t[m - 1];
+      m = (m + 1) / 2;
+    }
+    r = t[0];
+  } else if (scheme == S21_POLY_FMA) {
+    r = s21_vset1(c[d]);
+    for (int i = d - 1; i >= 0; i--) r = s21_vfmadd(r, x, s21_vset1(c[i]));
+  } else {
+    r = s21_vset1(c[d]);
+    for (int i = d - 1; i >= 0; i--) {
+      r = s21_vadd(s21_vmul(r, x), s21_vset1(c[i]));
+    }
+  }
+  return r;
+}
+
+// SIMD-путь для FMA только при аппаратной поддержке, иначе скалярный с
+// тем же округлением
+static int s21_poly_simd(s21_poly_scheme scheme) {
+#if defined(__FMA__)
+  (void)scheme;
+  return 1;
+#else
+  return scheme != S21_POLY_FMA;
+#endif
+}
+#endif
+
+void s21_polyval_n(const double *c, int degree, const double *x, double *res,
+                   size_t n, s21_poly_scheme scheme) {
+  size_t i = 0;
+#if defined(S21_VL)
+  if (s21_poly_simd(scheme)) {
+    for (; i + S21_VL <= n; i += S21_VL) {
+      s21_vstore(res + i, s21_vpoly(c, degree, s21_vload(x + i), scheme));
+    }
+  }
+#endif
+  for (; i < n; i++) res[i] = s21_polyval(c, degree, x[i], scheme);
+}
+
+void s21_ratval_n(const double *p, int pdeg, const double *q, int qdeg,
+                  const double *x, double *res, size_t n,
+                  s21_poly_scheme scheme) {
+  size_t i = 0;
+#if defined(S21_VL)
+  if (s21_poly_simd(scheme)) {
+    for (; i + S21_VL <= n; i += S21_VL) {
+      s21_vd v = s21_vload(x + i);
+      s21_vstore(res + i, s21_vdiv(s21_vpoly(p, pdeg, v, scheme),
+                                   s21_vpoly(q, qdeg, v, scheme)));
+    }
+  }
+#endif
+  for (; i < n; i++) res[i] = s21_ratval(p, pdeg, q, qdeg, x[i], scheme);
+}
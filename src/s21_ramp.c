@@ -0,0 +1,126 @@
+#include "s21_math.h"
+#include "utils.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Значения на арифметической прогрессии. Выход разбит на блоки по
+// S21_RAMP_STEPS шагов на дорожку: в начале блока точка x0 + k dx считается
+// ядром в long double, от неё дорожки (S21_VL соседних точек) стартуют
+// поворотом на j dx, затем каждый шаг — поворот на S21_VL dx (для exp —
+// умножение на e^(S21_VL da)). Шаг записан как v + (v (cos h - 1) + ...),
+// поправка мала при малом шаге, поэтому ошибка за шаг около 1 ulp и за
+// блок не превышает S21_RAMP_STEPS ulp.
+
+#define S21_RAMP_STEPS 16
+
+#if defined(__AVX__)
+typedef __m256d s21_vd;
+#define S21_VL 4
+#define s21_vload _mm256_loadu_pd
+#define s21_vstore _mm256_storeu_pd
+#define s21_vset1 _mm256_set1_pd
+#define s21_vadd _mm256_add_pd
+#define s21_vsub _mm256_sub_pd
+#define s21_vmul _mm256_mul_pd
+#elif defined(__SSE2__)
+typedef __m128d s21_vd;
+#define S21_VL 2
+#define s21_vload _mm_loadu_pd
+#define s21_vstore _mm_storeu_pd
+#define s21_vset1 _mm_set1_pd
+#define s21_vadd _mm_add_pd
+#define s21_vsub _mm_sub_pd
+#define s21_vmul _mm_mul_pd
+#else
+typedef double s21_vd;
+#define S21_VL 1
+#define s21_vload(p) (*(p))
+#define s21_vstore(p, v) (*(p) = (v))
+#define s21_vset1(x) (x)
+#define s21_vadd(a, b) ((a) + (b))
+#define s21_vsub(a, b) ((a) - (b))
+#define s21_vmul(a, b) ((a) * (b))
+#endif
+
+#define S21_RAMP_BLOCK (S21_RAMP_STEPS * S21_VL)
+
+// сохранение count <= S21_VL первых дорожек
+static inline void s21_ramp_store(double *dst, s21_vd v, size_t count) {
+  if (count == S21_VL) {
+    s21_vstore(dst, v);
+  } else {
+    double lanes[S21_VL];
+    s21_vstore(lanes, v);
+    for (size_t j = 0; j < count; j++) dst[j] = lanes[j];
+  }
+}
+
+void s21_sincos_ramp(double x0, double dx, double *s, double *c, size_t n) {
+  // sin и cos от j dx для старта дорожек; cos h - 1 = -2 sin^2(h / 2)
+  long double sj[S21_VL], cj[S21_VL], half_s, half_c, step_s, step_c;
+  for (int j = 0; j < S21_VL; j++) {
+    s21_sincos_kernel(j * (long double)dx, &sj[j], &cj[j]);
+  }
+  s21_sincos_kernel(S21_VL * (long double)dx / 2, &half_s, &half_c);
+  s21_sincos_kernel(S21_VL * (long double)dx, &step_s, &step_c);
+  s21_vd hm1 = s21_vset1((double)(-2 * half_s * half_s));
+  s21_vd hs = s21_vset1((double)step_s);
+  // якорь — сложением углов x0 и b dx: сумма x0 + b dx при больших x0
+  // округлялась бы в long double заметно для результата
+  long double s0, c0;
+  s21_sincos_kernel(x0, &s0, &c0);
+  for (size_t b = 0; b < n; b += S21_RAMP_BLOCK) {
+    size_t len = n - b < S21_RAMP_BLOCK ? n - b : S21_RAMP_BLOCK;
+    long double as, ac, bs, bc;
+    s21_sincos_kernel((long double)b * dx, &bs, &bc);
+    as = s0 * bc + c0 * bs;
+    ac = c0 * bc - s0 * bs;
+    double vs[S21_VL], vc[S21_VL];
+    for (int j = 0; j < S21_VL; j++) {
+      vs[j] = (double)(as * cj[j] + ac * sj[j]);
+      vc[j] = (double)(ac * cj[j] - as * sj[j]);
+    }
+    s21_vd vsin = s21_vload(vs), vcos = s21_vload(vc);
+    for (size_t i = 0; i < len; i += S21_VL) {
+      size_t count = len - i < S21_VL ? len - i : S21_VL;
+      if (s != NULL) s21_ramp_store(s + b + i, vsin, count);
+      if (c != NULL) s21_ramp_store(c + b + i, vcos, count);
+      s21_vd ds = s21_vadd(s21_vmul(vsin, hm1), s21_vmul(vcos, hs));
+      s21_vd dc = s21_vsub(s21_vmul(vcos, hm1), s21_vmul(vsin, hs));
+      vsin = s21_vadd(vsin, ds);
+      vcos = s21_vadd(vcos, dc);
+    }
+  }
+}
+
+// Блоки, где показатель выходит за (-708, 709), считаются поточечно: там
+// результат переполняется или теряет точность в денормализованных
+void s21_exp_ramp(double a0, double da, double *res, size_t n) {
+  long double ej[S21_VL];
+  for (int j = 0; j < S21_VL; j++) ej[j] = s21_exp_kernel(j * (long double)da);
+  s21_vd qm1 = s21_vset1((double)s21_expm1_kernel(S21_VL * (long double)da));
+  for (size_t b = 0; b < n; b += S21_RAMP_BLOCK) {
+    size_t len = n - b < S21_RAMP_BLOCK ? n - b : S21_RAMP_BLOCK;
+    long double first = a0 + (long double)b * da;
+    long double last = first + (long double)(len - 1) * da;
+    if (first > -708 && first < 709 && last > -708 && last < 709) {
+      long double anchor = s21_exp_kernel(first);
+      double v[S21_VL];
+      for (int j = 0; j < S21_VL; j++) v[j] = (double)(anchor * ej[j]);
+      s21_vd vexp = s21_vload(v);
+      for (size_t i = 0; i < len; i += S21_VL) {
+        size_t count = len - i < S21_VL ? len - i : S21_VL;
+        s21_ramp_store(res + b + i, vexp, count);
+        vexp = s21_vadd(vexp, s21_vmul(vexp, qm1));
+      }
+    } else {
+      for (size_t i = 0; i < len; i++) {
+        res[b + i] = s21_exp_kernel(first + (long double)i * da);
+      }
+    }
+  }
+}
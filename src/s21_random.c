@@ -0,0 +1,117 @@
+#include "s21_math.h"
+#include "utils.h"
+
+// Philox4x32-10: счётчик (номер пары, номер потока) шифруется ключом seed.
+// Пара значений i зависит только от (seed, stream, counter + i), поэтому
+// куски заполняются независимо в любом числе потоков, а результат не
+// зависит ни от числа потоков, ни от разбиения на вызовы.
+
+#define S21_PHILOX_M0 0xD2511F53u
+#define S21_PHILOX_M1 0xCD9E8D57u
+#define S21_PHILOX_W0 0x9E3779B9u
+#define S21_PHILOX_W1 0xBB67AE85u
+#define S21_RANDOM_CHUNK 8192  // чётный: пары не делятся между кусками
+
+typedef enum { S21_RAND_UNIFORM, S21_RAND_NORMAL, S21_RAND_EXP } s21_rand_kind;
+
+typedef struct {
+  s21_rng rng;
+  double *res;
+  s21_rand_kind kind;
+} s21_random_ctx;
+
+void s21_philox4x32(const uint32_t ctr[4], const uint32_t key[2],
+                    uint32_t out[4]) {
+  uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+  uint32_t k0 = key[0], k1 = key[1];
+  for (int r = 0; r < 10; r++) {
+    uint64_t p0 = (uint64_t)S21_PHILOX_M0 * c0;
+    uint64_t p1 = (uint64_t)S21_PHILOX_M1 * c2;
+    c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+    c1 = (uint32_t)p1;
+    c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+    c3 = (uint32_t)p0;
+    k0 += S21_PHILOX_W0;
+    k1 += S21_PHILOX_W1;
+  }
+  out[0] = c0;
+  out[1] = c1;
+  out[2] = c2;
+  out[3] = c3;
+}
+
+void s21_rng_init(s21_rng *rng, uint64_t seed, uint64_t stream) {
+  rng->seed = seed;
+  rng->stream = stream;
+  rng->counter = 0;
+}
+
+// два равномерных числа (k + 1/2) 2^-52 из (0, 1) для пары с номером index:
+// 52 бита k, чтобы сумма с 1/2 была точной и не округлялась до 1
+static void s21_rng_pair(const s21_rng *rng, uint64_t index, double u[2]) {
+  uint32_t ctr[4] = {(uint32_t)index, (uint32_t)(index >> 32),
+                     (uint32_t)rng->stream, (uint32_t)(rng->stream >> 32)};
+  uint32_t key[2] = {(uint32_t)rng->seed, (uint32_t)(rng->seed >> 32)};
+  uint32_t out[4];
+  s21_philox4x32(ctr, key, out);
+  for (int k = 0; k < 2; k++) {
+    uint64_t bits = ((uint64_t)out[2 * k] << 32 | out[2 * k + 1]) >> 12;
+    u[k] = (bits + 0.5) * (1.0 / 4503599627370496.0);  // 2^-52
+  }
+}
+
+static double s21_neg_log(double u) {
+  int e;
+  long double m = s21_log_kernel(u, &e);
+  return (double)(-(e * S21_LN2 + m));
+}
+
+// Бокс — Мюллер: радиус через ядра log и sqrt, угол 2 pi u через sin(pi x)
+static void s21_rand_fill(const s21_rng *rng, s21_rand_kind kind,
+                          uint64_t index, double *res, size_t len) {
+  for (size_t i = 0; i < len; i += 2, index++) {
+    double u[2];
+    double v[2];
+    s21_rng_pair(rng, index, u);
+    if (kind == S21_RAND_NORMAL) {
+      double r = s21_sqrt_kernel(2 * s21_neg_log(u[0]));
+      v[0] = (double)(r * s21_sinpi_kernel(2 * u[1] + 0.5L));
+      v[1] = (double)(r * s21_sinpi_kernel(2 * u[1]));
+    } else if (kind == S21_RAND_EXP) {
+      v[0] = s21_neg_log(u[0]);
+      v[1] = s21_neg_log(u[1]);
+    } else {
+      v[0] = u[0];
+      v[1] = u[1];
+    }
+    res[i] = v[0];
+    if (i + 1 < len) res[i + 1] = v[1];
+  }
+}
+
+static void s21_random_chunk(void *arg, size_t chunk, size_t begin,
+                             size_t end) {
+  s21_random_ctx *ctx = arg;
+  (void)chunk;
+  s21_rand_fill(&ctx->rng, ctx->kind, ctx->rng.counter + begin / 2,
+                ctx->res + begin, end - begin);
+}
+
+static void s21_random_run(s21_rng *rng, s21_rand_kind kind, double *res,
+                           size_t n) {
+  s21_random_ctx ctx = {*rng, res, kind};
+  s21_parallel_chunks(n, S21_RANDOM_CHUNK, s21_random_chunk, &ctx);
+  rng->counter += (n + 1) / 2;
+}
+
+void s21_rand_n(s21_rng *rng, double *res, size_t n) {
+  s21_random_run(rng, S21_RAND_UNIFORM, res, n);
+}
+
+void s21_randn_n(s21_rng *rng, double *res, size_t n) {
+  s21_random_run(rng, S21_RAND_NORMAL, res, n);
+}
+
+void s21_rande_n(s21_rng *rng, double *res, size_t n) {
+  s21_random_run(rng, S21_RAND_EXP, res, n);
+}
@@ -0,0 +1,409 @@
+#include <stdlib.h>
+
+#include "s21_math.h"
+#include "utils.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Сумма экспонент хранится как пара (m, s): sum = s * e^m. Каждый кусок
+// проходится один раз блоками: сначала максимум блока (блок уже в кэше),
+// затем сумма e^(x - max); пары блоков и кусков сливаются с пересчётом
+// к общему максимуму, поэтому переполнения нет при любых x. Экспоненты
+// считаются по полосам SIMD; группа с аргументом вне [-708, 0] (-inf,
+// NaN, денормализованный результат) уходит в скалярное ядро.
+
+#define S21_REDUCE_BLOCK 256
+#define S21_REDUCE_CHUNK 16384
+#define S21_VEXP_MIN -708.0
+#define S21_VEXP_DEGREE 13
+#define S21_VEXP_LN2_HI 6.93147180369123816490e-01  // младшие 32 бита — нули
+#define S21_VEXP_LN2_LO 1.90821492927058770002e-10
+
+#if defined(__AVX__)
+typedef __m256d s21_vd;
+#define S21_VL 4
+#define S21_ALL_LANES 0xf
+#define s21_vload _mm256_loadu_pd
+#define s21_vstore _mm256_storeu_pd
+#define s21_vset1 _mm256_set1_pd
+#define s21_vadd _mm256_add_pd
+#define s21_vsub _mm256_sub_pd
+#define s21_vmul _mm256_mul_pd
+#define s21_vand _mm256_and_pd
+#define s21_vle(a, b) _mm256_cmp_pd(a, b, _CMP_LE_OQ)
+#define s21_vmask _mm256_movemask_pd
+
+// 2^n по n из младших битов t = n + 1.5 * 2^52; в AVX без AVX2 целые
+// операции только над половинами по 128 бит
+static inline s21_vd s21_vpow2(s21_vd t) {
+  __m128i bias = _mm_set1_epi64x(1023);
+  __m128i lo = _mm_castpd_si128(_mm256_castpd256_pd128(t));
+  __m128i hi = _mm_castpd_si128(_mm256_extractf128_pd(t, 1));
+  lo = _mm_slli_epi64(_mm_add_epi64(lo, bias), 52);
+  hi = _mm_slli_epi64(_mm_add_epi64(hi, bias), 52);
+  return _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_castsi128_pd(lo)),
+                              _mm_castsi128_pd(hi), 1);
+}
+#elif defined(__SSE2__)
+typedef __m128d s21_vd;
+#define S21_VL 2
+#define S21_ALL_LANES 0x3
+#define s21_vload _mm_loadu_pd
+#define s21_vstore _mm_storeu_pd
+#define s21_vset1 _mm_set1_pd
+#define s21_vadd _mm_add_pd
+#define s21_vsub _mm_sub_pd
+#define s21_vmul _mm_mul_pd
+#define s21_vand _mm_and_pd
+#define s21_vle _mm_cmple_pd
+#define s21_vmask _mm_movemask_pd
+
+static inline s21_vd s21_vpow2(s21_vd t) {
+  __m128i n = _mm_add_epi64(_mm_castpd_si128(t), _mm_set1_epi64x(1023));
+  return _mm_castsi128_pd(_mm_slli_epi64(n, 52));
+}
+#endif
+
+#if defined(S21_VL)
+static const double s21_vexp_coef[S21_VEXP_DEGREE + 1] = {
+    1.0,             1.0,              1.0 / 2,       1.0 / 6,
+    1.0 / 24,        1.0 / 120,        1.0 / 720,     1.0 / 5040,
+    1.0 / 40320,     1.0 / 362880,     1.0 / 3628800, 1.0 / 39916800,
+    1.0 / 479001600, 1.0 / 6227020800};
+
+// e^(x - s) при d = x - s в [-708, 0]: ошибка округления d учитывается
+// (TwoSum), x - s = n ln2 + r, |r| <= ln2 / 2, ряд Тейлора до r^13
+static inline s21_vd s21_vexp_diff(s21_vd x, s21_vd s, s21_vd d) {
+  s21_vd z = s21_vsub(d, x);
+  s21_vd err = s21_vsub(s21_vsub(x, s21_vsub(d, z)), s21_vadd(s, z));
+  s21_vd shifter = s21_vset1(0x1.8p52);
+  s21_vd t = s21_vadd(s21_vmul(d, s21_vset1((double)S21_LOG2E)), shifter);
+  s21_vd k = s21_vsub(t, shifter);
+  s21_vd r = s21_vsub(d, s21_vmul(k, s21_vset1(S21_VEXP_LN2_HI)));
+  r = s21_vadd(s21_vsub(r, s21_vmul(k, s21_vset1(S21_VEXP_LN2_LO))), err);
+  s21_vd p = s21_vset1(s21_vexp_coef[S21_VEXP_DEGREE]);
+  for (int i = S21_VEXP_DEGREE - 1; i >= 0; i--) {
+    p = s21_vadd(s21_vmul(p, r), s21_vset1(s21_vexp_coef[i]));
+  }
+  return s21_vmul(p, s21_vpow2(t));
+}
+
+// 1, если во всех полосах d в [-708, 0]
+static inline int s21_vexp_ok(s21_vd d) {
+  s21_vd ok = s21_vand(s21_vle(s21_vset1(S21_VEXP_MIN), d),
+                       s21_vle(d, s21_vset1(0)));
+  return s21_vmask(ok) == S21_ALL_LANES;
+}
+#endif
+
+typedef struct {
+  long double m;
+  long double s;
+  int has_nan;
+  int has_inf;
+} s21_exp_sum;
+
+typedef struct {
+  const double *x;
+  double *res;
+  s21_exp_sum *parts;
+  long double shift;
+  long double scale;
+} s21_reduce_ctx;
+
+static void s21_exp_sum_merge(s21_exp_sum *acc, long double m, long double s) {
+  if (s > 0) {
+    if (acc->s == 0) {
+      acc->m = m;
+      acc->s = s;
+    } else if (m > acc->m) {
+      acc->s = acc->s * s21_exp_kernel(acc->m - m) + s;
+      acc->m = m;
+    } else {
+      acc->s += s * s21_exp_kernel(m - acc->m);
+    }
+  }
+}
+
+// сумма e^(x[i] - m) по x[i] <= m
+static long double s21_exp_block(const double *x, size_t len, double m) {
+  long double s = 0;
+  size_t i = 0;
+#if defined(S21_VL)
+  s21_vd vm = s21_vset1(m), sum = s21_vset1(0);
+  for (; i + S21_VL <= len; i += S21_VL) {
+    s21_vd vx = s21_vload(x + i), d = s21_vsub(vx, vm);
+    if (s21_vexp_ok(d)) {
+      sum = s21_vadd(sum, s21_vexp_diff(vx, vm, d));
+    } else {
+      for (size_t j = i; j < i + S21_VL; j++) {
+        if (x[j] <= m) s += s21_exp_kernel(x[j] - m);
+      }
+    }
+  }
+  double lanes[S21_VL];
+  s21_vstore(lanes, sum);
+  for (int j = 0; j < S21_VL; j++) s += lanes[j];
+#endif
+  for (; i < len; i++) {
+    if (x[i] <= m) s += s21_exp_kernel(x[i] - m);
+  }
+  return s;
+}
+
+static void s21_exp_sum_chunk(void *arg, size_t chunk, size_t begin,
+                              size_t end) {
+  s21_reduce_ctx *ctx = arg;
+  s21_exp_sum acc = {0, 0, 0, 0};
+  for (size_t b = begin; b < end; b += S21_REDUCE_BLOCK) {
+    const double *x = ctx->x + b;
+    size_t len = end - b < S21_REDUCE_BLOCK ? end - b : S21_REDUCE_BLOCK;
+    double m = S21_INF_NEG;
+    for (size_t i = 0; i < len; i++) {
+      if (x[i] != x[i]) {
+        acc.has_nan = 1;
+      } else if (x[i] == S21_INF) {
+        acc.has_inf = 1;
+      } else if (x[i] > m) {
+        m = x[i];
+      }
+    }
+    if (m != S21_INF_NEG) s21_exp_sum_merge(&acc, m, s21_exp_block(x, len, m));
+  }
+  ctx->parts[chunk] = acc;
+}
+
+// 0 — успех, -1 — нет памяти под частичные суммы
+static int s21_exp_sum_all(const double *x, size_t n, s21_exp_sum *acc) {
+  int status = 0;
+  size_t chunks = s21_chunk_count(n, S21_REDUCE_CHUNK);
+  *acc = (s21_exp_sum){0, 0, 0, 0};
+  if (chunks > 0) {
+    s21_exp_sum *parts = malloc(chunks * sizeof(*parts));
+    if (parts == NULL) {
+      status = -1;
+    } else {
+      s21_reduce_ctx ctx = {x, NULL, parts, 0, 0};
+      s21_parallel_chunks(n, S21_REDUCE_CHUNK, s21_exp_sum_chunk, &ctx);
+      for (size_t c = 0; c < chunks; c++) {
+        acc->has_nan |= parts[c].has_nan;
+        acc->has_inf |= parts[c].has_inf;
+        s21_exp_sum_merge(acc, parts[c].m, parts[c].s);
+      }
+      free(parts);
+    }
+  }
+  return status;
+}
+
+long double s21_logsumexp(const double *x, size_t n) {
+  s21_exp_sum acc;
+  long double result;
+  if (s21_exp_sum_all(x, n, &acc) != 0 || acc.has_nan) {
+    result = S21_NAN;
+  } else if (acc.has_inf) {
+    result = S21_INF;
+  } else if (acc.s == 0) {
+    result = S21_INF_NEG;
+  } else {
+    int e;
+    long double ln_s = s21_log_kernel(acc.s, &e);
+    result = acc.m + e * S21_LN2 + ln_s;
+  }
+  return result;
+}
+
+long double s21_sum_exp(const double *x, size_t n) {
+  s21_exp_sum acc;
+  long double result;
+  if (s21_exp_sum_all(x, n, &acc) != 0 || acc.has_nan) {
+    result = S21_NAN;
+  } else if (acc.has_inf) {
+    result = S21_INF;
+  } else {
+    result = acc.s * s21_exp_kernel(acc.m);
+  }
+  return result;
+}
+
+static void s21_softmax_chunk(void *arg, size_t chunk, size_t begin,
+                              size_t end) {
+  s21_reduce_ctx *ctx = arg;
+  (void)chunk;
+  size_t i = begin;
+#if defined(S21_VL)
+  // сдвиг — максимум одного из блоков, он точно представим в double
+  s21_vd shift = s21_vset1((double)ctx->shift);
+  s21_vd scale = s21_vset1((double)ctx->scale);
+  for (; i + S21_VL <= end; i += S21_VL) {
+    s21_vd vx = s21_vload(ctx->x + i), d = s21_vsub(vx, shift);
+    if (s21_vexp_ok(d)) {
+      s21_vstore(ctx->res + i, s21_vmul(s21_vexp_diff(vx, shift, d), scale));
+    } else {
+      for (size_t j = i; j < i + S21_VL; j++) {
+        ctx->res[j] = s21_exp_kernel(ctx->x[j] - ctx->shift) * ctx->scale;
+      }
+    }
+  }
+#endif
+  for (; i < end; i++) {
+    ctx->res[i] = s21_exp_kernel(ctx->x[i] - ctx->shift) * ctx->scale;
+  }
+}
+
+void s21_softmax(const double *x, double *res, size_t n) {
+  s21_exp_sum acc;
+  if (s21_exp_sum_all(x, n, &acc) != 0 || acc.has_nan || acc.has_inf ||
+      acc.s == 0) {
+    for (size_t i = 0; i < n; i++) res[i] = S21_NAN;
+  } else {
+    s21_reduce_ctx ctx = {x, res, NULL, acc.m, 1 / acc.s};
+    s21_parallel_chunks(n, S21_REDUCE_CHUNK, s21_softmax_chunk, &ctx);
+  }
+}
+
+// Компенсированное суммирование: четыре независимые пары (сумма, поправка)
+// по схеме TwoSum и точное произведение TwoProduct (FMA или разбиение
+// Деккера). Частичные результаты кусков сворачиваются в порядке номеров.
+
+#define S21_SUM_LANES 4
+#define S21_SUM_CHUNK 32768
+
+typedef struct {
+  double s;
+  double c;
+} s21_acc;
+
+typedef struct {
+  const double *x;
+  const double *y;
+  double scale;
+  s21_sum_mode mode;
+  s21_acc *parts;
+} s21_sum_ctx;
+
+static void s21_two_sum(s21_acc *a, double x) {
+  double t = a->s + x;
+  double z = t - a->s;
+  a->c += (a->s - (t - z)) + (x - z);
+  a->s = t;
+}
+
+// a * b = p + e точно
+static double s21_two_prod(double a, double b, double *e) {
+  double p = a * b;
+#if defined(__FMA__)
+  *e = __builtin_fma(a, b, -p);
+#else
+  double ta = 134217729.0 * a, tb = 134217729.0 * b;
+  double ahi = ta - (ta - a), alo = a - ahi;
+  double bhi = tb - (tb - b), blo = b - bhi;
+  *e = ((ahi * bhi - p) + ahi * blo + alo * bhi) + alo * blo;
+#endif
+  return p;
+}
+
+static void s21_sum_step(s21_acc *lane, const s21_sum_ctx *ctx, size_t i) {
+  double a = ctx->x[i] * ctx->scale;
+  if (ctx->y == NULL) {
+    if (ctx->mode == S21_SUM_FAST) {
+      lane->s += a;
+    } else {
+      s21_two_sum(lane, a);
+    }
+  } else {
+    double b = ctx->y == ctx->x ? a : ctx->y[i];
+    if (ctx->mode == S21_SUM_FAST) {
+      lane->s += a * b;
+    } else {
+      double e;
+      s21_two_sum(lane, s21_two_prod(a, b, &e));
+      lane->c += e;
+    }
+  }
+}
+
+static void s21_sum_chunk(void *arg, size_t chunk, size_t begin, size_t end) {
+  s21_sum_ctx *ctx = arg;
+  s21_acc lane[S21_SUM_LANES] = {{0, 0}};
+  size_t i = begin;
+  for (; i + S21_SUM_LANES <= end; i += S21_SUM_LANES) {
+    for (int j = 0; j < S21_SUM_LANES; j++) s21_sum_step(&lane[j], ctx, i + j);
+  }
+  for (; i < end; i++) s21_sum_step(&lane[0], ctx, i);
+  s21_acc acc = lane[0];
+  for (int j = 1; j < S21_SUM_LANES; j++) {
+    s21_two_sum(&acc, lane[j].s);
+    acc.c += lane[j].c;
+  }
+  ctx->parts[chunk] = acc;
+}
+
+static long double s21_sum_all(const double *x, const double *y, size_t n,
+                               s21_sum_mode mode, double scale) {
+  long double result = 0;
+  size_t chunks = s21_chunk_count(n, S21_SUM_CHUNK);
+  if (chunks > 0) {
+    s21_acc *parts = malloc(chunks * sizeof(*parts));
+    if (parts == NULL) {
+      result = S21_NAN;
+    } else {
+      s21_sum_ctx ctx = {x, y, scale, mode, parts};
+      s21_parallel_chunks(n, S21_SUM_CHUNK, s21_sum_chunk, &ctx);
+      s21_acc acc = parts[0];
+      for (size_t c = 1; c < chunks; c++) {
+        s21_two_sum(&acc, parts[c].s);
+        acc.c += parts[c].c;
+      }
+      result = (long double)acc.s + acc.c;
+      free(parts);
+    }
+  }
+  return result;
+}
+
+long double s21_fsum(const double *x, size_t n, s21_sum_mode mode) {
+  return s21_sum_all(x, NULL, n, mode, 1.0);
+}
+
+long double s21_dot(const double *x, const double *y, size_t n,
+                    s21_sum_mode mode) {
+  return s21_sum_all(x, y, n, mode, 1.0);
+}
+
+long double s21_norm2(const double *x, size_t n, s21_sum_mode mode) {
+  long double sq = s21_sum_all(x, x, n, mode, 1.0);
+  long double result;
+  if (sq == sq && sq != S21_INF && sq >= 1e-290) {
+    result = s21_sqrt_kernel(sq);
+  } else {
+    // квадраты переполнились или ушли в денормализованные (или все нули):
+    // масштабируем на степень двойки, близкую к max|x|
+    double amax = 0;
+    int has_nan = 0;
+    for (size_t i = 0; i < n; i++) {
+      double a = s21_fabs(x[i]);
+      if (a != a) {
+        has_nan = 1;
+      } else if (a > amax) {
+        amax = a;
+      }
+    }
+    if (has_nan) {
+      result = S21_NAN;
+    } else if (amax == S21_INF) {
+      result = S21_INF;
+    } else if (amax == 0) {
+      result = 0;
+    } else {
+      int e = (int)((s21_double_bits(amax) >> 52) & 0x7ff) - 1023;
+      sq = s21_sum_all(x, x, n, mode, s21_scale2(1.0, -e));
+      result = s21_scale2(s21_sqrt_kernel(sq), e);
+    }
+  }
+  return result;
+}
@@ -0,0 +1,92 @@
+#include "s21_math.h"
+
+// Элементы собираются блоками в буфер на стеке, обрабатываются непрерывным
+// пакетным ядром и раскладываются обратно. Все чтения блока выполняются до
+// записи, поэтому работа на месте (in == out, incx == incy) безопасна.
+
+#define S21_STRIDED_BLOCK 128
+
+typedef void (*s21_unary_n)(const double *x, double *res, size_t n);
+typedef void (*s21_binary_n)(const double *x, const double *y, double *res,
+                             size_t n);
+
+static void s21_strided_apply(s21_unary_n fn, const double *in, ptrdiff_t incx,
+                              double *out, ptrdiff_t incy, size_t n) {
+  if (incx == 1 && incy == 1) {
+    fn(in, out, n);
+  } else {
+    double buf[S21_STRIDED_BLOCK];
+    for (size_t start = 0; start < n; start += S21_STRIDED_BLOCK) {
+      size_t m = n - start < S21_STRIDED_BLOCK ? n - start : S21_STRIDED_BLOCK;
+      const double *src = in + (ptrdiff_t)start * incx;
+      double *dst = out + (ptrdiff_t)start * incy;
+      for (size_t i = 0; i < m; i++) buf[i] = src[(ptrdiff_t)i * incx];
+      fn(buf, buf, m);
+      for (size_t i = 0; i < m; i++) dst[(ptrdiff_t)i * incy] = buf[i];
+    }
+  }
+}
+
+static void s21_strided_apply2(s21_binary_n fn, const double *x,
+                               ptrdiff_t incx, const double *y, ptrdiff_t incy,
+                               double *out, ptrdiff_t incz, size_t n) {
+  if (incx == 1 && incy == 1 && incz == 1) {
+    fn(x, y, out, n);
+  } else {
+    double bx[S21_STRIDED_BLOCK], by[S21_STRIDED_BLOCK];
+    for (size_t start = 0; start < n; start += S21_STRIDED_BLOCK) {
+      size_t m = n - start < S21_STRIDED_BLOCK ? n - start : S21_STRIDED_BLOCK;
+      const double *sx = x + (ptrdiff_t)start * incx;
+      const double *sy = y + (ptrdiff_t)start * incy;
+      double *dst = out + (ptrdiff_t)start * incz;
+      for (size_t i = 0; i < m; i++) {
+        bx[i] = sx[(ptrdiff_t)i * incx];
+        by[i] = sy[(ptrdiff_t)i * incy];
+      }
+      fn(bx, by, bx, m);
+      for (size_t i = 0; i < m; i++) dst[(ptrdiff_t)i * incz] = bx[i];
+    }
+  }
+}
+
+#define S21_STRIDED(name)                                                    \
+  void s21_##name##_strided(const double *in, ptrdiff_t incx, double *out,   \
+                            ptrdiff_t incy, size_t n) {                      \
+    s21_strided_apply(s21_##name##_n, in, incx, out, incy, n);               \
+  }
+
+S21_STRIDED(acos)
+S21_STRIDED(asin)
+S21_STRIDED(atan)
+S21_STRIDED(cbrt)
+S21_STRIDED(ceil)
+S21_STRIDED(cos)
+S21_STRIDED(erf)
+S21_STRIDED(erfc)
+S21_STRIDED(exp)
+S21_STRIDED(exp2)
+S21_STRIDED(exp10)
+S21_STRIDED(expm1)
+S21_STRIDED(fabs)
+S21_STRIDED(floor)
+S21_STRIDED(lgamma)
+S21_STRIDED(log)
+S21_STRIDED(log1p)
+S21_STRIDED(log2)
+S21_STRIDED(log10)
+S21_STRIDED(rsqrt)
+S21_STRIDED(rsqrt_fast)
+S21_STRIDED(sin)
+S21_STRIDED(sqrt)
+S21_STRIDED(tan)
+S21_STRIDED(tgamma)
+
+void s21_fmod_strided(const double *x, ptrdiff_t incx, const double *y,
+                      ptrdiff_t incy, double *out, ptrdiff_t incz, size_t n) {
+  s21_strided_apply2(s21_fmod_n, x, incx, y, incy, out, incz, n);
+}
+
+void s21_pow_strided(const double *base, ptrdiff_t incb, const double *exp,
+                     ptrdiff_t ince, double *out, ptrdiff_t incz, size_t n) {
+  s21_strided_apply2(s21_pow_n, base, incb, exp, ince, out, incz, n);
+}
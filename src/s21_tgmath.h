@@ -0,0 +1,29 @@
+#ifndef S21_TGMATH_H
+#define S21_TGMATH_H
+
+#include "s21_math.h"
+
+// Выбор версии функции по типу аргумента на этапе компиляции, как в
+// <tgmath.h>: float — s21_xxxf, long double — s21_xxxl, остальные типы
+// (double и целые) — исходная s21_xxx. Имя функции внутри собственного
+// макроса не раскрывается повторно, поэтому s21_sin(x) для double по-прежнему
+// вызывает функцию s21_sin, а &s21_sin и s21_sin без скобок — её адрес.
+
+#define S21_TG(fn, x) \
+  _Generic((x), float: fn##f, long double: fn##l, default: fn)(x)
+
+#define s21_atan(x) S21_TG(s21_atan, x)
+#define s21_ceil(x) S21_TG(s21_ceil, x)
+#define s21_cos(x) S21_TG(s21_cos, x)
+#define s21_exp(x) S21_TG(s21_exp, x)
+#define s21_exp2(x) S21_TG(s21_exp2, x)
+#define s21_fabs(x) S21_TG(s21_fabs, x)
+#define s21_floor(x) S21_TG(s21_floor, x)
+#define s21_log(x) S21_TG(s21_log, x)
+#define s21_log2(x) S21_TG(s21_log2, x)
+#define s21_log10(x) S21_TG(s21_log10, x)
+#define s21_sin(x) S21_TG(s21_sin, x)
+#define s21_sqrt(x) S21_TG(s21_sqrt, x)
+#define s21_tan(x) S21_TG(s21_tan, x)
+
+#endif
@@ -0,0 +1,303 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#include "s21_math.h"
+#include "utils.h"
+
+// Для каждой функции — список реализаций, первая служит эталоном точности.
+// Погрешность кандидата — максимум ULP от эталона на фиксированной выборке
+// из рабочего диапазона функции и на особых значениях (NaN, нули,
+// денормализованные, огромные, бесконечности), скорость — лучшее из
+// нескольких прогонов только на выборке из диапазона.
+
+#define S21_TUNE_SAMPLES 2048
+#define S21_TUNE_SPECIAL 16
+#define S21_TUNE_RUNS 7
+
+typedef struct {
+  const char *name;
+  s21_batch_fn fn;
+} s21_tune_cand;
+
+typedef struct {
+  const char *name;
+  const char *names;  // для s21_tune_candidates
+  const s21_tune_cand *cand;
+  int count;
+  double lo, hi;  // диапазон выборки
+  int log_scale;  // выборка равномерна по порядку величины
+} s21_tune_info;
+
+static const s21_tune_cand s21_cos_cand[] = {{"poly", s21_cos_poly_n},
+                                             {"sinpi", s21_cos_sinpi_n}};
+static const s21_tune_cand s21_exp_cand[] = {{"table", s21_exp_table_n}};
+static const s21_tune_cand s21_log_cand[] = {{"table", s21_log_table_n},
+                                             {"series", s21_log_series_n}};
+static const s21_tune_cand s21_rsqrt_cand[] = {{"simd", s21_rsqrt_simd_n},
+                                               {"scalar", s21_rsqrt_scalar_n},
+                                               {"fast", s21_rsqrt_fast_n}};
+static const s21_tune_cand s21_sin_cand[] = {{"poly", s21_sin_poly_n},
+                                             {"sinpi", s21_sin_sinpi_n}};
+static const s21_tune_cand s21_sqrt_cand[] = {{"simd", s21_sqrt_simd_n},
+                                              {"scalar", s21_sqrt_scalar_n}};
+
+static const s21_tune_info s21_tune_table[S21_TUNE_COUNT] = {
+    [S21_TUNE_COS] = {"cos", "poly sinpi", s21_cos_cand, 2, -100, 100, 0},
+    [S21_TUNE_EXP] = {"exp", "table", s21_exp_cand, 1, -700, 700, 0},
+    [S21_TUNE_LOG] = {"log", "table series", s21_log_cand, 2, -300, 300, 1},
+    [S21_TUNE_RSQRT] = {"rsqrt", "simd scalar fast", s21_rsqrt_cand, 3, -300,
+                        300, 1},
+    [S21_TUNE_SIN] = {"sin", "poly sinpi", s21_sin_cand, 2, -100, 100, 0},
+    [S21_TUNE_SQRT] = {"sqrt", "simd scalar", s21_sqrt_cand, 2, -300, 300,
+                       1}};
+
+// до настройки действуют исходные реализации
+static int s21_tune_bound[S21_TUNE_COUNT] = {
+    [S21_TUNE_COS] = 0,   [S21_TUNE_EXP] = 0, [S21_TUNE_LOG] = 1,
+    [S21_TUNE_RSQRT] = 0, [S21_TUNE_SIN] = 0, [S21_TUNE_SQRT] = 0};
+static double s21_tune_budget[S21_TUNE_COUNT] = {1, 1, 1, 1, 1, 1};
+static pthread_once_t s21_tune_once = PTHREAD_ONCE_INIT;
+static char s21_tune_cpu_name[80];
+
+// модель процессора и расширения, с которыми собрана библиотека
+static void s21_tune_detect_cpu(void) {
+  char brand[49] = "unknown";
+#if defined(__x86_64__) || defined(__i386__)
+  unsigned int regs[12];
+  if (__get_cpuid_max(0x80000000, NULL) >= 0x80000004) {
+    for (unsigned int i = 0; i < 3; i++) {
+      __get_cpuid(0x80000002 + i, &regs[4 * i], &regs[4 * i + 1],
+                  &regs[4 * i + 2], &regs[4 * i + 3]);
+    }
+    memcpy(brand, regs, 48);
+    brand[48] = '\0';
+  }
+#endif
+  const char *simd = "generic";
+#if defined(__AVX__)
+  simd = "avx";
+#elif defined(__SSE2__)
+  simd = "sse2";
+#endif
+  char *p = brand;
+  while (*p == ' ') p++;
+  snprintf(s21_tune_cpu_name, sizeof(s21_tune_cpu_name), "%s/%s", p, simd);
+  for (p = s21_tune_cpu_name; *p; p++) {
+    if (*p == '\n') *p = ' ';
+  }
+}
+
+static int s21_tune_run(const char *path);
+static int s21_tune_read(const char *path);
+
+static void s21_tune_init(void) {
+  s21_tune_detect_cpu();
+  const char *path = getenv("S21_TUNE_CACHE");
+  if (path != NULL && *path != '\0' && s21_tune_read(path) != 0) {
+    s21_tune_run(path);
+  }
+}
+
+static void s21_tune_ensure(void) {
+  pthread_once(&s21_tune_once, s21_tune_init);
+}
+
+static int s21_tune_valid(s21_tune_fn fn) {
+  return (unsigned int)fn < S21_TUNE_COUNT;
+}
+
+// расстояние в ULP между двумя double (NaN совпадает только с NaN)
+static double s21_ulp_distance(double a, double b) {
+  double d;
+  if (a != a || b != b) {
+    d = (a != a && b != b) ? 0 : S21_INF;
+  } else {
+    int64_t ia = (int64_t)s21_double_bits(a);
+    int64_t ib = (int64_t)s21_double_bits(b);
+    if (ia < 0) ia = INT64_MIN - ia;
+    if (ib < 0) ib = INT64_MIN - ib;
+    d = ia > ib ? (double)((uint64_t)ia - (uint64_t)ib)
+                : (double)((uint64_t)ib - (uint64_t)ia);
+  }
+  return d;
+}
+
+static void s21_tune_sample(const s21_tune_info *info, double *x) {
+  for (int i = 0; i < S21_TUNE_SAMPLES; i++) {
+    // шаг по золотому сечению равномерно покрывает отрезок
+    long double t = i * 0.6180339887498948482L;
+    t -= (long double)(int64_t)t;
+    long double v = info->lo + (info->hi - info->lo) * t;
+    x[i] = info->log_scale ? (double)s21_exp2_kernel(v * 3.3219280948873623L)
+                           : (double)v;
+  }
+}
+
+static const double s21_tune_special[S21_TUNE_SPECIAL] = {
+    S21_NAN, 0.0,      -0.0,    5e-324,
+    -5e-324, 1e-310,   -1e-310, S21_DBL_MIN,
+    1e17,    -1e17,    1e300,   -1e300,
+    1.7e308, -1.7e308, S21_INF, S21_INF_NEG};
+
+static double s21_tune_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double s21_tune_time(s21_batch_fn fn, const double *x, double *res) {
+  double best = S21_INF;
+  for (int r = 0; r < S21_TUNE_RUNS; r++) {
+    double t0 = s21_tune_now();
+    fn(x, res, S21_TUNE_SAMPLES);
+    double t = s21_tune_now() - t0;
+    if (t < best) best = t;
+  }
+  return best;
+}
+
+static int s21_tune_find(const s21_tune_info *info, const char *name) {
+  int k = -1;
+  for (int c = 0; c < info->count && k < 0; c++) {
+    if (strcmp(info->cand[c].name, name) == 0) k = c;
+  }
+  return k;
+}
+
+static int s21_tune_save(const char *path) {
+  int status = -1;
+  FILE *f = fopen(path, "w");
+  if (f != NULL) {
+    fprintf(f, "s21_tune 1\ncpu %s\n", s21_tune_cpu_name);
+    for (int fn = 0; fn < S21_TUNE_COUNT; fn++) {
+      const s21_tune_info *info = &s21_tune_table[fn];
+      fprintf(f, "%s %s\n", info->name, info->cand[s21_tune_bound[fn]].name);
+    }
+    status = fclose(f) == 0 ? 0 : -1;
+  }
+  return status;
+}
+
+static int s21_tune_run(const char *path) {
+  enum { total = S21_TUNE_SAMPLES + S21_TUNE_SPECIAL };
+  double x[total], ref[total], res[total];
+  memcpy(x + S21_TUNE_SAMPLES, s21_tune_special, sizeof(s21_tune_special));
+  for (int fn = 0; fn < S21_TUNE_COUNT; fn++) {
+    const s21_tune_info *info = &s21_tune_table[fn];
+    s21_tune_sample(info, x);
+    info->cand[0].fn(x, ref, total);
+    int best = 0;
+    double best_time = S21_INF;
+    for (int c = 0; c < info->count; c++) {
+      info->cand[c].fn(x, res, total);
+      double err = 0;
+      for (int i = 0; i < total; i++) {
+        double d = s21_ulp_distance(res[i], ref[i]);
+        if (d > err) err = d;
+      }
+      if (err <= s21_tune_budget[fn]) {
+        double t = s21_tune_time(info->cand[c].fn, x, res);
+        if (t < best_time) {
+          best_time = t;
+          best = c;
+        }
+      }
+    }
+    s21_tune_bound[fn] = best;
+  }
+  return path != NULL ? s21_tune_save(path) : 0;
+}
+
+static int s21_tune_read(const char *path) {
+  int status = -1;
+  FILE *f = fopen(path, "r");
+  if (f != NULL) {
+    char line[128];
+    int chosen[S21_TUNE_COUNT];
+    int ok = fgets(line, sizeof(line), f) != NULL &&
+             strcmp(line, "s21_tune 1\n") == 0;
+    if (ok && fgets(line, sizeof(line), f) != NULL) {
+      line[strcspn(line, "\n")] = '\0';
+      ok = strncmp(line, "cpu ", 4) == 0 &&
+           strcmp(line + 4, s21_tune_cpu_name) == 0;
+    } else {
+      ok = 0;
+    }
+    for (int fn = 0; fn < S21_TUNE_COUNT && ok; fn++) {
+      const s21_tune_info *info = &s21_tune_table[fn];
+      char name[32], impl[32];
+      ok = fgets(line, sizeof(line), f) != NULL &&
+           sscanf(line, "%31s %31s", name, impl) == 2 &&
+           strcmp(name, info->name) == 0 &&
+           (chosen[fn] = s21_tune_find(info, impl)) >= 0;
+    }
+    fclose(f);
+    if (ok) {
+      memcpy(s21_tune_bound, chosen, sizeof(chosen));
+      status = 0;
+    }
+  }
+  return status;
+}
+
+int s21_tune(const char *path) {
+  s21_tune_ensure();
+  return s21_tune_run(path);
+}
+
+int s21_tune_load(const char *path) {
+  s21_tune_ensure();
+  return s21_tune_read(path);
+}
+
+void s21_tune_set_budget(s21_tune_fn fn, double max_ulp) {
+  if (s21_tune_valid(fn) && max_ulp >= 0) {
+    s21_tune_budget[fn] = max_ulp;
+  }
+}
+
+double s21_tune_get_budget(s21_tune_fn fn) {
+  return s21_tune_valid(fn) ? s21_tune_budget[fn] : S21_NAN;
+}
+
+const char *s21_tune_get(s21_tune_fn fn) {
+  s21_tune_ensure();
+  const char *name = NULL;
+  if (s21_tune_valid(fn)) {
+    name = s21_tune_table[fn].cand[s21_tune_bound[fn]].name;
+  }
+  return name;
+}
+
+int s21_tune_set(s21_tune_fn fn, const char *name) {
+  s21_tune_ensure();
+  int k = -1;
+  if (s21_tune_valid(fn) && name != NULL) {
+    k = s21_tune_find(&s21_tune_table[fn], name);
+    if (k >= 0) s21_tune_bound[fn] = k;
+  }
+  return k < 0 ? -1 : 0;
+}
+
+const char *s21_tune_candidates(s21_tune_fn fn) {
+  return s21_tune_valid(fn) ? s21_tune_table[fn].names : NULL;
+}
+
+const char *s21_tune_cpu(void) {
+  s21_tune_ensure();
+  return s21_tune_cpu_name;
+}
+
+s21_batch_fn s21_tuned_kernel(s21_tune_fn fn) {
+  s21_tune_ensure();
+  return s21_tune_table[fn].cand[s21_tune_bound[fn]].fn;
+}
@@ -0,0 +1,383 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "s21_math.h"
+
+// s21math — применяет функции библиотеки к двоичным файлам из double.
+// Вход по возможности отображается в память (mmap), иначе читается
+// потоково с двойной буферизацией; вычисления идут пакетными ядрами
+// на всех ядрах процессора.
+
+#define S21_CLI_MAX_CHAIN 16
+#define S21_CLI_BLOCK (1 << 20)  // элементов в блоке потокового режима
+#define S21_CLI_CHUNK 65536      // элементов на поток за раз
+#define S21_CLI_TILE 2048        // цепочка проходит плитку, пока та в кэше
+
+typedef void (*s21_cli_fn)(const double *x, double *res, size_t n);
+
+typedef struct {
+  const char *name;
+  s21_cli_fn fn;
+} s21_cli_entry;
+
+typedef struct {
+  s21_cli_fn fn;  // NULL для pow/fmod с константой
+  char op;        // 'p' — pow, 'm' — fmod
+  double arg;
+} s21_cli_step;
+
+typedef struct {
+  s21_cli_step steps[S21_CLI_MAX_CHAIN];
+  int len;
+  const double *in;
+  double *out;
+} s21_cli_chain;
+
+typedef struct {
+  int fd;
+  double *buf;
+  size_t want;
+  size_t got;
+  size_t tail;  // байты после последнего целого double
+  int error;
+} s21_cli_read;
+
+static const s21_cli_entry s21_cli_table[] = {
+    {"acos", s21_acos_n},   {"asin", s21_asin_n},
+    {"atan", s21_atan_n},   {"cbrt", s21_cbrt_n},
+    {"ceil", s21_ceil_n},   {"cos", s21_cos_n},
+    {"erf", s21_erf_n},     {"erfc", s21_erfc_n},
+    {"exp", s21_exp_n},     {"exp2", s21_exp2_n},
+    {"exp10", s21_exp10_n}, {"expm1", s21_expm1_n},
+    {"fabs", s21_fabs_n},   {"floor", s21_floor_n},
+    {"lgamma", s21_lgamma_n}, {"log", s21_log_n},
+    {"log1p", s21_log1p_n}, {"log2", s21_log2_n},
+    {"log10", s21_log10_n}, {"rsqrt", s21_rsqrt_n},
+    {"sin", s21_sin_n},     {"sqrt", s21_sqrt_n},
+    {"tan", s21_tan_n},     {"tgamma", s21_tgamma_n}};
+
+static void s21_cli_usage(FILE *f) {
+  fprintf(f,
+          "usage: s21math [-t threads] [-o output] [-q] chain [input]\n"
+          "  chain  comma-separated steps applied left to right, e.g.\n"
+          "         log,sqrt or pow:2.5,log10 (pow:e and fmod:y take a\n"
+          "         constant second argument)\n"
+          "  input  file of native doubles; stdin when omitted or '-'\n"
+          "  -o     output file; stdout when omitted or '-'\n"
+          "  -t     worker threads, 0 = all cores (default)\n"
+          "  -q     do not print the throughput report\n"
+          "functions:");
+  for (size_t i = 0; i < sizeof(s21_cli_table) / sizeof(*s21_cli_table); i++) {
+    fprintf(f, " %s", s21_cli_table[i].name);
+  }
+  fprintf(f, " pow:e fmod:y\n");
+}
+
+static int s21_cli_parse_step(const char *tok, size_t len, s21_cli_step *st) {
+  int ok = 0;
+  st->fn = NULL;
+  st->op = 0;
+  if ((len > 4 && strncmp(tok, "pow:", 4) == 0) ||
+      (len > 5 && strncmp(tok, "fmod:", 5) == 0)) {
+    char num[64];
+    size_t skip = tok[0] == 'p' ? 4 : 5;
+    if (len - skip < sizeof(num)) {
+      char *end;
+      memcpy(num, tok + skip, len - skip);
+      num[len - skip] = '\0';
+      st->arg = strtod(num, &end);
+      st->op = tok[0] == 'p' ? 'p' : 'm';
+      ok = end != num && *end == '\0';
+    }
+  } else {
+    for (size_t i = 0; i < sizeof(s21_cli_table) / sizeof(*s21_cli_table);
+         i++) {
+      if (strlen(s21_cli_table[i].name) == len &&
+          strncmp(s21_cli_table[i].name, tok, len) == 0) {
+        st->fn = s21_cli_table[i].fn;
+        ok = 1;
+      }
+    }
+  }
+  return ok;
+}
+
+static int s21_cli_parse_chain(const char *spec, s21_cli_chain *chain) {
+  int ok = 1;
+  chain->len = 0;
+  while (ok && *spec) {
+    size_t len = strcspn(spec, ",");
+    if (chain->len == S21_CLI_MAX_CHAIN ||
+        !s21_cli_parse_step(spec, len, &chain->steps[chain->len])) {
+      fprintf(stderr, "s21math: bad step '%.*s'\n", (int)len, spec);
+      ok = 0;
+    } else {
+      chain->len++;
+    }
+    spec += len;
+    if (*spec == ',') spec++;
+  }
+  return ok && chain->len > 0;
+}
+
+static void s21_cli_step_apply(const s21_cli_step *st, const double *x,
+                               double *res, size_t n) {
+  if (st->fn != NULL) {
+    st->fn(x, res, n);
+  } else if (st->op == 'p') {
+    for (size_t i = 0; i < n; i++) res[i] = s21_pow(x[i], st->arg);
+  } else {
+    for (size_t i = 0; i < n; i++) res[i] = s21_fmod(x[i], st->arg);
+  }
+}
+
+static void s21_cli_chunk(void *arg, size_t chunk, size_t begin, size_t end) {
+  s21_cli_chain *chain = arg;
+  (void)chunk;
+  for (size_t t = begin; t < end; t += S21_CLI_TILE) {
+    size_t m = end - t < S21_CLI_TILE ? end - t : S21_CLI_TILE;
+    s21_cli_step_apply(&chain->steps[0], chain->in + t, chain->out + t, m);
+    for (int s = 1; s < chain->len; s++) {
+      s21_cli_step_apply(&chain->steps[s], chain->out + t, chain->out + t, m);
+    }
+  }
+}
+
+static void s21_cli_run(s21_cli_chain *chain, const double *in, double *out,
+                        size_t n) {
+  chain->in = in;
+  chain->out = out;
+  s21_parallel_chunks(n, S21_CLI_CHUNK, s21_cli_chunk, chain);
+}
+
+static void *s21_cli_reader(void *arg) {
+  s21_cli_read *rd = arg;
+  char *p = (char *)rd->buf + rd->tail;
+  size_t want = rd->want * sizeof(double) - rd->tail;
+  size_t got = rd->tail;
+  while (want > 0) {
+    ssize_t r = read(rd->fd, p, want);
+    if (r < 0 && errno == EINTR) continue;
+    if (r < 0) rd->error = errno;
+    if (r <= 0) break;
+    p += r;
+    got += (size_t)r;
+    want -= (size_t)r;
+  }
+  rd->got = got / sizeof(double);
+  rd->tail = got % sizeof(double);
+  return NULL;
+}
+
+static int s21_cli_write_all(int fd, const void *buf, size_t bytes) {
+  const char *p = buf;
+  int status = 0;
+  while (bytes > 0 && status == 0) {
+    ssize_t w = write(fd, p, bytes);
+    if (w < 0 && errno == EINTR) continue;
+    if (w <= 0) {
+      status = -1;
+    } else {
+      p += w;
+      bytes -= (size_t)w;
+    }
+  }
+  return status;
+}
+
+// Потоковый режим: пока считается блок, следующий уже читается
+static int s21_cli_stream(s21_cli_chain *chain, int in_fd, int out_fd,
+                          size_t *total) {
+  double *buf[2];
+  double *out = malloc(S21_CLI_BLOCK * sizeof(double));
+  int status = 0;
+  buf[0] = malloc(S21_CLI_BLOCK * sizeof(double));
+  buf[1] = malloc(S21_CLI_BLOCK * sizeof(double));
+  *total = 0;
+  if (buf[0] == NULL || buf[1] == NULL || out == NULL) {
+    fprintf(stderr, "s21math: out of memory\n");
+    status = -1;
+  } else {
+    s21_cli_read rd = {in_fd, buf[0], S21_CLI_BLOCK, 0, 0, 0};
+    s21_cli_reader(&rd);
+    int cur = 0;
+    while (status == 0 && rd.got > 0) {
+      size_t n = rd.got;
+      size_t tail = rd.tail;
+      pthread_t reader;
+      // недочитанный хвост переносим в начало следующего буфера
+      memcpy(buf[cur ^ 1], (char *)buf[cur] + n * sizeof(double), tail);
+      rd = (s21_cli_read){in_fd, buf[cur ^ 1], S21_CLI_BLOCK, 0, tail, 0};
+      int async = pthread_create(&reader, NULL, s21_cli_reader, &rd) == 0;
+      if (!async) s21_cli_reader(&rd);
+      s21_cli_run(chain, buf[cur], out, n);
+      if (s21_cli_write_all(out_fd, out, n * sizeof(double)) != 0) {
+        fprintf(stderr, "s21math: write failed: %s\n", strerror(errno));
+        status = -1;
+      }
+      if (async) pthread_join(reader, NULL);
+      *total += n;
+      cur ^= 1;
+    }
+    if (status == 0 && rd.error != 0) {
+      fprintf(stderr, "s21math: read failed: %s\n", strerror(rd.error));
+      status = -1;
+    } else if (status == 0 && rd.tail != 0) {
+      fprintf(stderr, "s21math: input is not a whole number of doubles\n");
+      status = -1;
+    }
+  }
+  free(buf[0]);
+  free(buf[1]);
+  free(out);
+  return status;
+}
+
+// Вход отображён в память; выход — отображение файла либо запись блоками.
+// Отображается только файл -o, открытый самой программой: у stdout могут
+// быть смещение и O_APPEND, ftruncate затёр бы уже записанные данные
+static int s21_cli_mapped(s21_cli_chain *chain, const double *in, size_t n,
+                          int out_fd, int map_out) {
+  int status = 0;
+  struct stat st;
+  double *out = MAP_FAILED;
+  size_t bytes = n * sizeof(double);
+  if (n > 0 && map_out && fstat(out_fd, &st) == 0 && S_ISREG(st.st_mode) &&
+      ftruncate(out_fd, (off_t)bytes) == 0) {
+    out = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, out_fd, 0);
+  }
+  if (out != MAP_FAILED) {
+    s21_cli_run(chain, in, out, n);
+    if (munmap(out, bytes) != 0) status = -1;
+  } else if (n > 0) {
+    double *buf = malloc(S21_CLI_BLOCK * sizeof(double));
+    if (buf == NULL) {
+      fprintf(stderr, "s21math: out of memory\n");
+      status = -1;
+    }
+    for (size_t off = 0; status == 0 && off < n; off += S21_CLI_BLOCK) {
+      size_t m = n - off < S21_CLI_BLOCK ? n - off : S21_CLI_BLOCK;
+      s21_cli_run(chain, in + off, buf, m);
+      if (s21_cli_write_all(out_fd, buf, m * sizeof(double)) != 0) {
+        fprintf(stderr, "s21math: write failed: %s\n", strerror(errno));
+        status = -1;
+      }
+    }
+    free(buf);
+  }
+  return status;
+}
+
+// 1, если оба дескриптора — один и тот же обычный файл: выход с O_TRUNC
+// или ftruncate затёр бы вход до чтения
+static int s21_cli_same_file(int in_fd, int out_fd) {
+  struct stat in_st, out_st;
+  return fstat(in_fd, &in_st) == 0 && fstat(out_fd, &out_st) == 0 &&
+         S_ISREG(in_st.st_mode) && in_st.st_dev == out_st.st_dev &&
+         in_st.st_ino == out_st.st_ino;
+}
+
+static double s21_cli_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv) {
+  int threads = 0, quiet = 0, status = 0;
+  const char *out_path = NULL, *in_path = NULL;
+  s21_cli_chain chain;
+  int opt;
+  while ((opt = getopt(argc, argv, "t:o:qh")) != -1) {
+    if (opt == 't') {
+      threads = atoi(optarg);
+    } else if (opt == 'o') {
+      out_path = optarg;
+    } else if (opt == 'q') {
+      quiet = 1;
+    } else {
+      s21_cli_usage(opt == 'h' ? stdout : stderr);
+      return opt == 'h' ? 0 : 2;
+    }
+  }
+  if (optind >= argc || argc - optind > 2) {
+    s21_cli_usage(stderr);
+    return 2;
+  }
+  if (!s21_cli_parse_chain(argv[optind], &chain)) return 2;
+  if (optind + 1 < argc && strcmp(argv[optind + 1], "-") != 0) {
+    in_path = argv[optind + 1];
+  }
+  s21_set_threads(threads);
+
+  int in_fd = in_path ? open(in_path, O_RDONLY) : STDIN_FILENO;
+  int out_fd = STDOUT_FILENO;
+  if (in_fd >= 0 && out_path != NULL && strcmp(out_path, "-") != 0) {
+    out_fd = open(out_path, O_RDWR | O_CREAT, 0644);
+  }
+  if (in_fd < 0 || out_fd < 0) {
+    fprintf(stderr, "s21math: %s: %s\n", in_fd < 0 ? in_path : out_path,
+            strerror(errno));
+    return 1;
+  }
+  // файл выхода обрезается только после проверки, что это не вход
+  struct stat st;
+  if (s21_cli_same_file(in_fd, out_fd)) {
+    fprintf(stderr, "s21math: output is the input file\n");
+    status = -1;
+  } else if (out_fd != STDOUT_FILENO && fstat(out_fd, &st) == 0 &&
+             S_ISREG(st.st_mode) && ftruncate(out_fd, 0) != 0) {
+    fprintf(stderr, "s21math: %s: %s\n", out_path, strerror(errno));
+    status = -1;
+  }
+  if (status != 0) {
+    if (out_fd != STDOUT_FILENO) close(out_fd);
+    if (in_fd != STDIN_FILENO) close(in_fd);
+    return 1;
+  }
+
+  double start = s21_cli_now();
+  size_t total = 0;
+  void *map = MAP_FAILED;
+  if (fstat(in_fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, in_fd, 0);
+  }
+  if (map != MAP_FAILED) {
+    if (st.st_size % sizeof(double) != 0) {
+      fprintf(stderr, "s21math: input is not a whole number of doubles\n");
+      status = -1;
+    } else {
+      posix_madvise(map, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+      total = (size_t)st.st_size / sizeof(double);
+      status = s21_cli_mapped(&chain, map, total, out_fd,
+                              out_fd != STDOUT_FILENO);
+    }
+    munmap(map, (size_t)st.st_size);
+  } else {
+    status = s21_cli_stream(&chain, in_fd, out_fd, &total);
+  }
+  double elapsed = s21_cli_now() - start;
+
+  if (out_fd != STDOUT_FILENO && close(out_fd) != 0) status = -1;
+  if (in_fd != STDIN_FILENO) close(in_fd);
+  if (status == 0 && !quiet) {
+    double bytes = (double)total * sizeof(double);
+    if (elapsed <= 0) elapsed = 1e-9;
+    fprintf(stderr,
+            "s21math: %zu elements in %.3f s, %.3f GB/s, %.3f Melem/s "
+            "(%d threads)\n",
+            total, elapsed, bytes / elapsed / 1e9, total / elapsed / 1e6,
+            s21_get_threads());
+  }
+  return status == 0 ? 0 : 1;
+}
@@ -0,0 +1,381 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+#include "s21_math.h"
+#include "utils.h"
+
+// s21prof — профиль скалярных функций библиотеки по классам входов в двух
+// режимах: пропускная способность (независимые вызовы) и задержка (аргумент
+// следующего вызова зависит от результата предыдущего). Счётчики берутся
+// из perf_event_open одной группой; если они недоступны (нет прав, не
+// Linux, виртуальная машина без PMU), считаются такты rdtsc. Каждое
+// измерение повторяется в режимах S21_FP_STRICT и S21_FTZ_DAZ (s21_fp_mode),
+// классы subnormal и underflow показывают разницу между ними. Цифры на
+// вызов включают накладные расходы цикла измерения.
+
+#define S21_PROF_INPUTS 4096
+#define S21_PROF_MAX_EVENTS 8
+#define S21_PROF_MAX_FILTER 64
+
+typedef struct {
+  const char *name;
+  long double (*f1)(double);
+  long double (*f2)(double, double);
+} s21_prof_fn;
+
+typedef struct {
+  const char *name;
+  double lo, hi;
+  int log_scale;  // равномерно по порядку величины
+} s21_prof_class;
+
+typedef struct {
+  const char *name;
+  uint32_t type;
+  uint64_t config;
+  int fd;
+  uint64_t value;
+} s21_prof_event;
+
+typedef struct {
+  double ns;
+  uint64_t ticks;  // rdtsc в запасном режиме
+  uint64_t calls;
+} s21_prof_result;
+
+static const s21_prof_fn s21_prof_table[] = {
+    {"acos", s21_acos, NULL},     {"asin", s21_asin, NULL},
+    {"atan", s21_atan, NULL},     {"cbrt", s21_cbrt, NULL},
+    {"ceil", s21_ceil, NULL},     {"cos", s21_cos, NULL},
+    {"erf", s21_erf, NULL},       {"erfc", s21_erfc, NULL},
+    {"exp", s21_exp, NULL},       {"exp2", s21_exp2, NULL},
+    {"exp10", s21_exp10, NULL},   {"expm1", s21_expm1, NULL},
+    {"fabs", s21_fabs, NULL},     {"floor", s21_floor, NULL},
+    {"fmod", NULL, s21_fmod},     {"lgamma", s21_lgamma, NULL},
+    {"log", s21_log, NULL},       {"log1p", s21_log1p, NULL},
+    {"log2", s21_log2, NULL},     {"log10", s21_log10, NULL},
+    {"pow", NULL, s21_pow},       {"rsqrt", s21_rsqrt, NULL},
+    {"rsqrt_fast", s21_rsqrt_fast, NULL},
+    {"sin", s21_sin, NULL},       {"sqrt", s21_sqrt, NULL},
+    {"tan", s21_tan, NULL},       {"tgamma", s21_tgamma, NULL}};
+
+// special — NaN, бесконечности, нули и субнормальные, по кругу;
+// underflow — аргументы, при которых exp уходит в субнормальные
+static const s21_prof_class s21_prof_classes[] = {
+    {"tiny", 1e-300, 1e-10, 1},   {"subnormal", 4.9e-324, 2.2e-308, 1},
+    {"unit", 0, 1, 0},            {"medium", 1, 100, 0},
+    {"large", 1e3, 1e300, 1},     {"negative", -100, -1e-3, 0},
+    {"underflow", -745, -708, 0}, {"special", 0, 0, 0}};
+
+static const char *const s21_prof_fp_names[2] = {"strict", "ftz"};
+
+// второй аргумент pow и fmod: целый, дробный, отрицательный показатели
+static const double s21_prof_second[4] = {2.0, 0.5, -1.5, 3.7};
+
+// маска всегда равна нулю, но компилятор этого не знает: через неё
+// аргумент следующего вызова зависит от результата предыдущего
+static volatile uint64_t s21_prof_zero = 0;
+static double s21_prof_sink;
+
+static s21_prof_event s21_prof_events[S21_PROF_MAX_EVENTS];
+static int s21_prof_nevents = 0;
+static int s21_prof_counters = 0;
+
+static void s21_prof_usage(FILE *f) {
+  fprintf(f,
+          "usage: s21prof [-t ms] [-l | -T] [-f strict|ftz] "
+          "[-e name=config]... [function]...\n"
+          "  -t ms      time per measurement (default 20)\n"
+          "  -l, -T     latency only / throughput only (default both)\n"
+          "  -f mode    only strict or only FTZ/DAZ mode (default both)\n"
+          "  -e n=cfg   extra raw PMU event, e.g. -e div=0x1000114\n"
+          "Prints per function, input class and mode: ns, cycles,\n"
+          "instructions, IPC and branch misses per call. Without access\n"
+          "to perf_event_open (see kernel.perf_event_paranoid) only rdtsc\n"
+          "ticks per call are shown.\n");
+}
+
+static double s21_prof_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint64_t s21_prof_ticks(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return (uint64_t)(s21_prof_now() * 1e9);
+#endif
+}
+
+static void s21_prof_add_event(const char *name, uint32_t type,
+                               uint64_t config) {
+  if (s21_prof_nevents < S21_PROF_MAX_EVENTS) {
+    s21_prof_events[s21_prof_nevents++] =
+        (s21_prof_event){name, type, config, -1, 0};
+  }
+}
+
+#if defined(__linux__)
+static int s21_prof_intel(void) {
+  int intel = 0;
+#if defined(__x86_64__) || defined(__i386__)
+  unsigned int a, b, c, d;
+  if (__get_cpuid(0, &a, &b, &c, &d)) {
+    intel = b == 0x756e6547 && d == 0x49656e69 && c == 0x6c65746e;
+  }
+#endif
+  return intel;
+}
+#endif
+
+// группа счётчиков с cycles во главе; события, которых нет на этом
+// процессоре, выключаются по одному
+static const char *s21_prof_open(void) {
+  const char *reason = "perf_event_open is Linux-only";
+#if defined(__linux__)
+  int leader = -1;
+  for (int i = 0; i < s21_prof_nevents && (i == 0 || leader >= 0); i++) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = s21_prof_events[i].type;
+    attr.config = s21_prof_events[i].config;
+    attr.disabled = i == 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    int fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+    if (i == 0) {
+      leader = fd;
+      if (fd < 0) reason = strerror(errno);
+    }
+    s21_prof_events[i].fd = fd;
+  }
+  s21_prof_counters = leader >= 0;
+#endif
+  return s21_prof_counters ? NULL : reason;
+}
+
+static void s21_prof_start(void) {
+#if defined(__linux__)
+  if (s21_prof_counters) {
+    ioctl(s21_prof_events[0].fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(s21_prof_events[0].fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+#endif
+}
+
+static void s21_prof_stop(void) {
+#if defined(__linux__)
+  if (s21_prof_counters) {
+    uint64_t buf[S21_PROF_MAX_EVENTS + 1] = {0};
+    ioctl(s21_prof_events[0].fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    if (read(s21_prof_events[0].fd, buf, sizeof(buf)) > 0) {
+      // значения идут в порядке открытия, пропуская неоткрытые события
+      uint64_t k = 1;
+      for (int i = 0; i < s21_prof_nevents; i++) {
+        s21_prof_events[i].value =
+            s21_prof_events[i].fd >= 0 && k <= buf[0] ? buf[k++] : 0;
+      }
+    }
+  }
+#endif
+}
+
+static void s21_prof_inputs(const s21_prof_class *cls, double *x, double *y) {
+  static const double special[8] = {S21_NAN, S21_INF,      S21_INF_NEG, 0.0,
+                                    -0.0,    4.9e-324,     1e-310,
+                                    S21_MAX};
+  double u[S21_PROF_INPUTS];
+  s21_rng rng;
+  s21_rng_init(&rng, 2024, 0);
+  s21_rand_n(&rng, u, S21_PROF_INPUTS);
+  for (int i = 0; i < S21_PROF_INPUTS; i++) {
+    if (strcmp(cls->name, "special") == 0) {
+      x[i] = special[i % 8];
+    } else if (cls->log_scale) {
+      double l0 = s21_log2(cls->lo), l1 = s21_log2(cls->hi);
+      x[i] = s21_exp2(l0 + (l1 - l0) * u[i]);
+    } else {
+      x[i] = cls->lo + (cls->hi - cls->lo) * u[i];
+    }
+    y[i] = s21_prof_second[i % 4];
+  }
+}
+
+static void s21_prof_loop(const s21_prof_fn *fn, const double *x,
+                          const double *y, uint64_t reps, int latency) {
+  uint64_t mask = s21_prof_zero;
+  double r = 0;
+  for (uint64_t rep = 0; rep < reps; rep++) {
+    for (size_t i = 0; i < S21_PROF_INPUTS; i++) {
+      size_t k = latency ? i + (size_t)(s21_double_bits(r) & mask) : i;
+      r = fn->f1 ? (double)fn->f1(x[k]) : (double)fn->f2(x[k], y[k]);
+      if (!latency) s21_prof_sink = r;
+    }
+  }
+  s21_prof_sink = r;
+}
+
+static s21_prof_result s21_prof_measure(const s21_prof_fn *fn,
+                                        const double *x, const double *y,
+                                        int latency, double budget) {
+  // калибровка: одно повторение, затем столько, чтобы уложиться в budget
+  double t0 = s21_prof_now();
+  s21_prof_loop(fn, x, y, 1, latency);
+  double once = s21_prof_now() - t0;
+  uint64_t reps = once > 0 && budget > once ? (uint64_t)(budget / once) : 1;
+  s21_prof_result res;
+  s21_prof_start();
+  uint64_t c0 = s21_prof_ticks();
+  t0 = s21_prof_now();
+  s21_prof_loop(fn, x, y, reps, latency);
+  res.ns = (s21_prof_now() - t0) * 1e9;
+  res.ticks = s21_prof_ticks() - c0;
+  s21_prof_stop();
+  res.calls = reps * S21_PROF_INPUTS;
+  return res;
+}
+
+static void s21_prof_header(void) {
+  printf("%-11s %-9s %-5s %-6s %10s", "function", "class", "mode", "fp",
+         "ns");
+  if (s21_prof_counters) {
+    for (int i = 0; i < s21_prof_nevents; i++) {
+      if (s21_prof_events[i].fd >= 0) {
+        printf(" %12s", s21_prof_events[i].name);
+      }
+    }
+    printf(" %6s", "IPC");
+  } else {
+    printf(" %10s", "ticks");
+  }
+  printf("\n");
+}
+
+static void s21_prof_row(const char *fn, const char *cls, int latency,
+                         s21_fp_mode fp, const s21_prof_result *r) {
+  double calls = (double)r->calls;
+  printf("%-11s %-9s %-5s %-6s %10.2f", fn, cls, latency ? "lat" : "thr",
+         s21_prof_fp_names[fp], r->ns / calls);
+  if (s21_prof_counters) {
+    for (int i = 0; i < s21_prof_nevents; i++) {
+      if (s21_prof_events[i].fd >= 0) {
+        printf(" %12.2f", s21_prof_events[i].value / calls);
+      }
+    }
+    double cycles = (double)s21_prof_events[0].value;
+    printf(" %6.2f", cycles > 0 ? s21_prof_events[1].value / cycles : 0.0);
+  } else {
+    printf(" %10.2f", r->ticks / calls);
+  }
+  printf("\n");
+}
+
+static int s21_prof_wanted(const char *name, char **filter, int nfilter) {
+  int wanted = nfilter == 0;
+  for (int i = 0; i < nfilter && !wanted; i++) {
+    wanted = strcmp(filter[i], name) == 0;
+  }
+  return wanted;
+}
+
+int main(int argc, char **argv) {
+  double budget = 0.02;
+  int modes = 3;  // 1 — задержка, 2 — пропускная способность
+  int fp_modes = 3;  // 1 — S21_FP_STRICT, 2 — S21_FTZ_DAZ
+  int opt;
+#if defined(__linux__)
+  s21_prof_add_event("cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+  s21_prof_add_event("instructions", PERF_TYPE_HARDWARE,
+                     PERF_COUNT_HW_INSTRUCTIONS);
+  s21_prof_add_event("branch-miss", PERF_TYPE_HARDWARE,
+                     PERF_COUNT_HW_BRANCH_MISSES);
+  if (s21_prof_intel()) {
+    // ARITH.DIVIDER_ACTIVE и FP_ASSIST.ANY (Skylake и новее), cmask = 1
+    s21_prof_add_event("divider", PERF_TYPE_RAW, 0x1000114);
+    s21_prof_add_event("fp-assist", PERF_TYPE_RAW, 0x1001eca);
+  }
+#endif
+  while ((opt = getopt(argc, argv, "t:lTf:e:h")) != -1) {
+    if (opt == 't') {
+      budget = atof(optarg) / 1000;
+    } else if (opt == 'l') {
+      modes = 1;
+    } else if (opt == 'T') {
+      modes = 2;
+    } else if (opt == 'f' && (strcmp(optarg, "strict") == 0 ||
+                              strcmp(optarg, "ftz") == 0)) {
+      fp_modes = strcmp(optarg, "ftz") == 0 ? 2 : 1;
+    } else if (opt == 'e' && strchr(optarg, '=') != NULL) {
+      char *eq = strchr(optarg, '=');
+      *eq = '\0';
+#if defined(__linux__)
+      s21_prof_add_event(optarg, PERF_TYPE_RAW, strtoull(eq + 1, NULL, 0));
+#endif
+    } else {
+      s21_prof_usage(opt == 'h' ? stdout : stderr);
+      return opt == 'h' ? 0 : 2;
+    }
+  }
+  char **filter = argv + optind;
+  int nfilter = argc - optind;
+  int nfn = (int)(sizeof(s21_prof_table) / sizeof(s21_prof_table[0]));
+  for (int i = 0; i < nfilter; i++) {
+    int known = 0;
+    for (int f = 0; f < nfn; f++) {
+      known |= strcmp(filter[i], s21_prof_table[f].name) == 0;
+    }
+    if (!known) {
+      fprintf(stderr, "s21prof: unknown function '%s'\n", filter[i]);
+      return 2;
+    }
+  }
+
+  const char *reason = s21_prof_open();
+  if (reason != NULL) {
+    fprintf(stderr, "s21prof: counters unavailable (%s), using rdtsc\n",
+            reason);
+  }
+  s21_prof_header();
+  int ncls = (int)(sizeof(s21_prof_classes) / sizeof(s21_prof_classes[0]));
+  static double x[S21_PROF_INPUTS], y[S21_PROF_INPUTS];
+  for (int f = 0; f < nfn; f++) {
+    const s21_prof_fn *fn = &s21_prof_table[f];
+    if (!s21_prof_wanted(fn->name, filter, nfilter)) continue;
+    for (int c = 0; c < ncls; c++) {
+      s21_prof_inputs(&s21_prof_classes[c], x, y);
+      for (int latency = 1; latency >= 0; latency--) {
+        for (int fp = S21_FP_STRICT; fp <= S21_FTZ_DAZ; fp++) {
+          if (!(modes & (latency ? 1 : 2)) || !(fp_modes & (1 << fp))) continue;
+          s21_fp_mode_push((s21_fp_mode)fp);
+          s21_prof_result r = s21_prof_measure(fn, x, y, latency, budget);
+          s21_fp_mode_pop();
+          s21_prof_row(fn->name, s21_prof_classes[c].name, latency,
+                       (s21_fp_mode)fp, &r);
+        }
+      }
+    }
+  }
+  return 0;
+}
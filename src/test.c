@@ -1,14 +1,28 @@
 #include <check.h>
+#include <complex.h>
+#include <errno.h>
 #include <float.h>
 #include <limits.h>
 #include <math.h>
+#include <pthread.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 #include "./s21_math.h"
+#include "./s21_tgmath.h"
 
 #define TOLERANCE 1e-5
 #define M_PI 3.14159265358979323846
 
+// погрешность результата, округлённого до double, в ULP double
+// относительно ref, посчитанного в long double
+static double double_ulps(long double v, long double ref) {
+  double r = (double)ref;
+  double ulp = nextafter(fabs(r), INFINITY) - fabs(r);
+  return fabsl((double)v - ref) / ulp;
+}
+
 // Test case for the abs function
 START_TEST(test_abs_positive) {
   // Test when x is a positive number
@@ -96,6 +110,24 @@ START_TEST(test_asin_special_cases) {
 }
 END_TEST
 
+START_TEST(test_asin_acos_near_one) {
+  // Test the whole range in ulp, including arguments close to +-1
+  double worst = 0;
+  for (int i = 0; i <= 20000; i++) {
+    double x = -1 + i * 0.0001;
+    worst = fmax(worst, double_ulps(s21_asin(x), asinl(x)));
+    worst = fmax(worst, double_ulps(s21_acos(x), acosl(x)));
+  }
+  double edge[4] = {0.999, 0.9999999, 1 - 1e-15, -0.9999999};
+  for (int i = 0; i < 4; i++) {
+    worst = fmax(worst, double_ulps(s21_asin(edge[i]), asinl(edge[i])));
+    worst = fmax(worst, double_ulps(s21_acos(edge[i]), acosl(edge[i])));
+  }
+  ck_assert_double_lt(worst, 1);
+  ck_assert(signbit((double)s21_asin(-0.0)));
+}
+END_TEST
+
 // Test case for the ceil function
 START_TEST(test_ceil_positive) {
   // Test when x is a positive decimal number
@@ -499,6 +531,23 @@ START_TEST(test_sin_special_cases) {
 
 END_TEST
 
+START_TEST(test_sin_cos_large_arguments) {
+  // Test arguments past the Cody-Waite range: reduction by exact 2/pi bits
+  double xs[] = {1073741824.0, 2147483648.0, -1e10,  1e15, 1e19,
+                 1e22,         1e300,        -1e300, DBL_MAX};
+  for (size_t i = 0; i < sizeof(xs) / sizeof(xs[0]); i++) {
+    ck_assert_double_eq_tol(s21_sin(xs[i]), sin(xs[i]), 1e-16);
+    ck_assert_double_eq_tol(s21_cos(xs[i]), cos(xs[i]), 1e-16);
+  }
+  long double lx[] = {0x1p63L, 1e30L, 1e4000L, -LDBL_MAX};
+  for (size_t i = 0; i < sizeof(lx) / sizeof(lx[0]); i++) {
+    ck_assert_ldouble_eq_tol(s21_sinl(lx[i]), sinl(lx[i]), 1e-18L);
+    ck_assert_ldouble_eq_tol(s21_cosl(lx[i]), cosl(lx[i]), 1e-18L);
+  }
+}
+
+END_TEST
+
 // Test case for the sqrt function
 START_TEST(test_sqrt_positive) {
   // Test when x is a positive number
@@ -533,6 +582,23 @@ START_TEST(test_sqrt_special_cases) {
 
 END_TEST
 
+START_TEST(test_sqrt_large_and_subnormal) {
+  ck_assert_double_eq(s21_sqrt(1e300), sqrt(1e300));
+  ck_assert_double_eq_tol(s21_sqrt(4e-320) * 1e160, sqrt(4e-320) * 1e160,
+                          TOLERANCE);
+  ck_assert_double_eq(s21_sqrt(INFINITY), INFINITY);
+}
+END_TEST
+
+START_TEST(test_sqrt_batch) {
+  double x[7] = {0.0, 1.0, 2.0, 9.0, 25.1, 1e-300, -1.0};
+  double res[7];
+  s21_sqrt_n(x, res, 7);
+  for (int i = 0; i < 6; i++) ck_assert_double_eq(res[i], sqrt(x[i]));
+  ck_assert(isnan(res[6]));
+}
+END_TEST
+
 // Test case for the tan function
 START_TEST(test_tan_positive) {
   // Test when x is a positive angle in radians
@@ -561,6 +627,1910 @@ START_TEST(test_tan_special_cases) {
 
 END_TEST
 
+// Test case for the cbrt function
+START_TEST(test_cbrt_positive) {
+  ck_assert_double_eq_tol(s21_cbrt(27.0), cbrt(27.0), TOLERANCE);
+  ck_assert_double_eq_tol(s21_cbrt(2.0), cbrt(2.0), TOLERANCE);
+  ck_assert_double_eq_tol(s21_cbrt(1e-300) * 1e100, cbrt(1e-300) * 1e100,
+                          TOLERANCE);
+}
+END_TEST
+
+START_TEST(test_cbrt_negative) {
+  // В отличие от s21_pow(x, 1.0 / 3) отрицательный аргумент допустим
+  ck_assert_double_eq_tol(s21_cbrt(-8.0), cbrt(-8.0), TOLERANCE);
+  ck_assert_double_eq_tol(s21_cbrt(-0.001), cbrt(-0.001), TOLERANCE);
+}
+END_TEST
+
+START_TEST(test_cbrt_special_cases) {
+  ck_assert(isnan(s21_cbrt(NAN)));
+  ck_assert_double_eq(s21_cbrt(INFINITY), INFINITY);
+  ck_assert_double_eq(s21_cbrt(-INFINITY), -INFINITY);
+  ck_assert_double_eq(s21_cbrt(0.0), 0.0);
+}
+END_TEST
+
+// Test case for the exp2 function
+START_TEST(test_exp2_values) {
+  ck_assert_double_eq(s21_exp2(10.0), 1024.0);
+  ck_assert_double_eq_tol(s21_exp2(0.5), exp2(0.5), TOLERANCE);
+  ck_assert_double_eq_tol(s21_exp2(-3.3), exp2(-3.3), TOLERANCE);
+}
+END_TEST
+
+START_TEST(test_exp2_special_cases) {
+  ck_assert(isnan(s21_exp2(NAN)));
+  ck_assert_double_eq(s21_exp2(INFINITY), INFINITY);
+  ck_assert_double_eq(s21_exp2(-INFINITY), 0.0);
+  ck_assert_double_eq(s21_exp2(2000.0), INFINITY);
+}
+END_TEST
+
+// Test case for the exp10 function
+START_TEST(test_exp10_values) {
+  ck_assert_double_eq_tol(s21_exp10(2.0), 100.0, TOLERANCE);
+  ck_assert_double_eq_tol(s21_exp10(-1.5), pow(10.0, -1.5), TOLERANCE);
+  ck_assert_double_eq_tol(s21_exp10(300.0) / 1e300, 1.0, TOLERANCE);
+}
+END_TEST
+
+START_TEST(test_exp10_special_cases) {
+  ck_assert(isnan(s21_exp10(NAN)));
+  ck_assert_double_eq(s21_exp10(INFINITY), INFINITY);
+  ck_assert_double_eq(s21_exp10(-INFINITY), 0.0);
+}
+END_TEST
+
+// Test case for the expm1 function
+START_TEST(test_expm1_small) {
+  // exp(x) - 1 для малых x не теряет значащих цифр
+  ck_assert_double_eq_tol(s21_expm1(1e-10) / 1e-10, expm1(1e-10) / 1e-10,
+                          1e-15);
+  ck_assert_double_eq_tol(s21_expm1(-1e-7) / 1e-7, expm1(-1e-7) / 1e-7,
+                          1e-15);
+}
+END_TEST
+
+START_TEST(test_expm1_values) {
+  ck_assert_double_eq_tol(s21_expm1(1.0), expm1(1.0), TOLERANCE);
+  ck_assert_double_eq_tol(s21_expm1(-5.0), expm1(-5.0), TOLERANCE);
+  ck_assert(isnan(s21_expm1(NAN)));
+  ck_assert_double_eq(s21_expm1(-INFINITY), -1.0);
+}
+END_TEST
+
+// Test case for the log1p function
+START_TEST(test_log1p_small) {
+  ck_assert_double_eq_tol(s21_log1p(1e-12) / 1e-12, log1p(1e-12) / 1e-12,
+                          1e-15);
+  ck_assert_double_eq_tol(s21_log1p(-1e-9) / 1e-9, log1p(-1e-9) / 1e-9,
+                          1e-15);
+}
+END_TEST
+
+START_TEST(test_log1p_values) {
+  ck_assert_double_eq_tol(s21_log1p(1.0), log1p(1.0), TOLERANCE);
+  ck_assert_double_eq_tol(s21_log1p(-0.5), log1p(-0.5), TOLERANCE);
+  ck_assert_double_eq_tol(s21_log1p(1e10), log1p(1e10), TOLERANCE);
+}
+END_TEST
+
+START_TEST(test_log1p_special_cases) {
+  ck_assert(isnan(s21_log1p(NAN)));
+  ck_assert(isnan(s21_log1p(-2.0)));
+  ck_assert_double_eq(s21_log1p(-1.0), -INFINITY);
+  ck_assert_double_eq(s21_log1p(INFINITY), INFINITY);
+}
+END_TEST
+
+// Test case for the log2 function
+START_TEST(test_log2_values) {
+  ck_assert_double_eq(s21_log2(1024.0), 10.0);
+  ck_assert_double_eq(s21_log2(0.125), -3.0);
+  ck_assert_double_eq_tol(s21_log2(3.0), log2(3.0), TOLERANCE);
+  ck_assert_double_eq_tol(s21_log2(1e-310), log2(1e-310), TOLERANCE);
+}
+END_TEST
+
+START_TEST(test_log2_special_cases) {
+  ck_assert(isnan(s21_log2(NAN)));
+  ck_assert(isnan(s21_log2(-1.0)));
+  ck_assert_double_eq(s21_log2(0.0), -INFINITY);
+  ck_assert_double_eq(s21_log2(INFINITY), INFINITY);
+}
+END_TEST
+
+// Test case for the log10 function
+START_TEST(test_log10_values) {
+  ck_assert_double_eq_tol(s21_log10(1000.0), 3.0, TOLERANCE);
+  ck_assert_double_eq_tol(s21_log10(0.02), log10(0.02), TOLERANCE);
+  ck_assert_double_eq_tol(s21_log10(1.0000001), log10(1.0000001), 1e-15);
+}
+END_TEST
+
+START_TEST(test_log10_special_cases) {
+  ck_assert(isnan(s21_log10(NAN)));
+  ck_assert(isnan(s21_log10(-1.0)));
+  ck_assert_double_eq(s21_log10(0.0), -INFINITY);
+  ck_assert_double_eq(s21_log10(INFINITY), INFINITY);
+}
+END_TEST
+
+START_TEST(test_exp_log_family_batch) {
+  double x[4] = {0.25, 1.0, 8.0, 100.0};
+  double res[4];
+  s21_log2_n(x, res, 4);
+  for (int i = 0; i < 4; i++)
+    ck_assert_double_eq(res[i], (double)s21_log2(x[i]));
+  s21_log10_n(x, res, 4);
+  for (int i = 0; i < 4; i++)
+    ck_assert_double_eq(res[i], (double)s21_log10(x[i]));
+  s21_log1p_n(x, res, 4);
+  for (int i = 0; i < 4; i++)
+    ck_assert_double_eq(res[i], (double)s21_log1p(x[i]));
+  s21_exp2_n(x, res, 4);
+  for (int i = 0; i < 4; i++)
+    ck_assert_double_eq(res[i], (double)s21_exp2(x[i]));
+  s21_exp10_n(x, res, 4);
+  for (int i = 0; i < 4; i++)
+    ck_assert_double_eq(res[i], (double)s21_exp10(x[i]));
+  s21_expm1_n(x, res, 4);
+  for (int i = 0; i < 4; i++)
+    ck_assert_double_eq(res[i], (double)s21_expm1(x[i]));
+  s21_cbrt_n(x, res, 4);
+  for (int i = 0; i < 4; i++)
+    ck_assert_double_eq(res[i], (double)s21_cbrt(x[i]));
+}
+END_TEST
+
+// Test case for the rsqrt function
+START_TEST(test_rsqrt_positive) {
+  ck_assert_double_eq_tol(s21_rsqrt(4.0), 0.5, TOLERANCE);
+  ck_assert_double_eq_tol(s21_rsqrt(2.0), 1 / sqrt(2.0), 1e-15);
+  ck_assert_double_eq_tol(s21_rsqrt(1e-300) * 1e-150, 1.0, 1e-15);
+}
+END_TEST
+
+START_TEST(test_rsqrt_fast_positive) {
+  // Быстрый уровень: относительная погрешность < 1e-10
+  ck_assert_double_eq_tol(s21_rsqrt_fast(3.0) * sqrt(3.0), 1.0, 1e-10);
+  ck_assert_double_eq_tol(s21_rsqrt_fast(1e200) * 1e100, 1.0, 1e-10);
+  ck_assert_double_eq_tol(s21_rsqrt_fast(4e-320) * sqrt(4e-320), 1.0, 1e-10);
+}
+END_TEST
+
+START_TEST(test_rsqrt_special_cases) {
+  ck_assert(isnan(s21_rsqrt(NAN)));
+  ck_assert(isnan(s21_rsqrt(-1.0)));
+  ck_assert_double_eq(s21_rsqrt(0.0), INFINITY);
+  ck_assert_double_eq(s21_rsqrt(INFINITY), 0.0);
+  ck_assert(isnan(s21_rsqrt_fast(-1.0)));
+  ck_assert_double_eq(s21_rsqrt_fast(0.0), INFINITY);
+  ck_assert_double_eq(s21_rsqrt_fast(INFINITY), 0.0);
+}
+END_TEST
+
+START_TEST(test_rsqrt_batch) {
+  double x[5] = {0.25, 1.0, 2.0, 100.0, 7.0};
+  double res[5];
+  s21_rsqrt_n(x, res, 5);
+  for (int i = 0; i < 5; i++)
+    ck_assert_double_eq_tol(res[i], 1 / sqrt(x[i]), 1e-15);
+  s21_rsqrt_fast_n(x, res, 5);
+  for (int i = 0; i < 5; i++)
+    ck_assert_double_eq_tol(res[i], 1 / sqrt(x[i]), 1e-9);
+}
+END_TEST
+
+// Test case for the fixed-point functions
+START_TEST(test_sin_cos_q15) {
+  // 8192 — pi/4, -16384 — -pi/2
+  ck_assert_int_le(abs(s21_sin_q15(8192) - 23170), 1);
+  ck_assert_int_le(abs(s21_cos_q15(8192) - 23170), 1);
+  ck_assert_int_eq(s21_sin_q15(-16384), -32767);
+  ck_assert_int_eq(s21_cos_q15(0), 32767);
+  ck_assert_int_eq(s21_sin_q15(0), 0);
+  for (int a = -32768; a < 32768; a += 97) {
+    double th = a * S21_PI / 32768;
+    ck_assert_double_eq_tol(s21_sin_q15(a) / 32768.0, sin(th), 3.5e-5);
+    ck_assert_double_eq_tol(s21_cos_q15(a) / 32768.0, cos(th), 3.5e-5);
+  }
+}
+END_TEST
+
+START_TEST(test_atan2_q15) {
+  ck_assert_int_eq(s21_atan2_q15(0, 0), 0);
+  ck_assert_int_le(abs(s21_atan2_q15(1000, 1000) - 8192), 1);
+  ck_assert_int_le(abs(s21_atan2_q15(-1000, -1000) + 24576), 1);
+  ck_assert_int_eq(s21_atan2_q15(0, -1000), 32767);
+  for (int y = -32768; y < 32768; y += 1021) {
+    for (int x = -32768; x < 32768; x += 997) {
+      double t = atan2(y, x) / S21_PI * 32768;
+      if (t > 32767) t = 32767;
+      ck_assert_double_eq_tol(s21_atan2_q15(y, x), t, 1.0);
+    }
+  }
+}
+END_TEST
+
+START_TEST(test_exp_q16) {
+  ck_assert_int_eq(s21_exp_q16(0), 65536);
+  ck_assert_int_le(abs(s21_exp_q16(65536) - 178145), 1);
+  ck_assert_int_eq(s21_exp_q16(800000), INT32_MAX);
+  ck_assert_int_eq(s21_exp_q16(-1000000), 0);
+  for (int32_t x = -700000; x < 680000; x += 12345) {
+    double t = s21_exp(x / 65536.0) * 65536;
+    ck_assert_double_eq_tol(s21_exp_q16(x), t, t * 1e-8 + 1);
+  }
+}
+END_TEST
+
+START_TEST(test_sqrt_q16) {
+  ck_assert_int_eq(s21_sqrt_q16(4 << 16), 2 << 16);
+  ck_assert_int_eq(s21_sqrt_q16(0), 0);
+  ck_assert_int_eq(s21_sqrt_q16(-65536), 0);
+  ck_assert_int_eq(s21_sqrt_q16(INT32_MAX), 11863283);
+  ck_assert_double_eq_tol(s21_sqrt_q16(2 << 16) / 65536.0, s21_sqrt(2.0),
+                          0.5 / 65536);
+}
+END_TEST
+
+START_TEST(test_fixed_batch) {
+  int16_t a[4] = {0, 8192, -8192, 16384};
+  int16_t b[4] = {100, -100, 0, 32767};
+  int16_t r16[4];
+  s21_sin_q15_n(a, r16, 4);
+  for (int i = 0; i < 4; i++) ck_assert_int_eq(r16[i], s21_sin_q15(a[i]));
+  s21_cos_q15_n(a, r16, 4);
+  for (int i = 0; i < 4; i++) ck_assert_int_eq(r16[i], s21_cos_q15(a[i]));
+  s21_atan2_q15_n(a, b, r16, 4);
+  for (int i = 0; i < 4; i++)
+    ck_assert_int_eq(r16[i], s21_atan2_q15(a[i], b[i]));
+  int32_t x[3] = {-65536, 65536, 9 << 16};
+  int32_t r32[3];
+  s21_exp_q16_n(x, r32, 3);
+  for (int i = 0; i < 3; i++) ck_assert_int_eq(r32[i], s21_exp_q16(x[i]));
+  s21_sqrt_q16_n(x, r32, 3);
+  for (int i = 0; i < 3; i++) ck_assert_int_eq(r32[i], s21_sqrt_q16(x[i]));
+}
+END_TEST
+
+// Test case for the fp16/bf16 functions
+START_TEST(test_f16_conversion) {
+  ck_assert_int_eq(s21_float_to_f16(1.0f), 0x3c00);
+  ck_assert_int_eq(s21_float_to_f16(-2.0f), 0xc000);
+  ck_assert_int_eq(s21_float_to_f16(65520.0f), 0x7c00);
+  ck_assert_int_eq(s21_float_to_f16(5.9604644775390625e-8f), 0x0001);
+  ck_assert(isnan(s21_f16_to_float(0x7e00)));
+  for (uint32_t h = 0; h < 0x7c00; h++) {
+    ck_assert_int_eq(s21_float_to_f16(s21_f16_to_float(h)), h);
+  }
+}
+END_TEST
+
+START_TEST(test_bf16_conversion) {
+  ck_assert_int_eq(s21_float_to_bf16(1.0f), 0x3f80);
+  ck_assert_int_eq(s21_float_to_bf16(-3.0f), 0xc040);
+  ck_assert_double_eq(s21_bf16_to_float(0x4049), 3.140625);
+  ck_assert(isnan(s21_bf16_to_float(s21_float_to_bf16(NAN))));
+}
+END_TEST
+
+START_TEST(test_f16_batch) {
+  float x[5] = {-3.0f, -0.5f, 0.001f, 1.0f, 2.5f};
+  uint16_t in[5], out[5];
+  for (int i = 0; i < 5; i++) in[i] = s21_float_to_f16(x[i]);
+  s21_exp_f16_n(in, out, 5);
+  for (int i = 0; i < 5; i++)
+    ck_assert_double_eq_tol(s21_f16_to_float(out[i]),
+                            exp(s21_f16_to_float(in[i])),
+                            exp(s21_f16_to_float(in[i])) * 1e-3);
+  s21_tanh_f16_n(in, out, 5);
+  for (int i = 0; i < 5; i++)
+    ck_assert_double_eq_tol(s21_f16_to_float(out[i]),
+                            tanh(s21_f16_to_float(in[i])), 1e-3);
+  s21_log_f16_n(in + 2, out, 3);
+  for (int i = 0; i < 3; i++)
+    ck_assert_double_eq_tol(s21_f16_to_float(out[i]),
+                            log(s21_f16_to_float(in[i + 2])), 4e-3);
+  s21_log_f16_n(in, out, 1);
+  ck_assert(isnan(s21_f16_to_float(out[0])));
+}
+END_TEST
+
+START_TEST(test_bf16_batch) {
+  float x[5] = {-3.0f, -0.5f, 0.001f, 1.0f, 60.0f};
+  uint16_t in[5], out[5];
+  for (int i = 0; i < 5; i++) in[i] = s21_float_to_bf16(x[i]);
+  s21_exp_bf16_n(in, out, 5);
+  for (int i = 0; i < 5; i++)
+    ck_assert_double_eq_tol(s21_bf16_to_float(out[i]),
+                            exp(s21_bf16_to_float(in[i])),
+                            exp(s21_bf16_to_float(in[i])) * 8e-3);
+  s21_tanh_bf16_n(in, out, 5);
+  for (int i = 0; i < 5; i++)
+    ck_assert_double_eq_tol(s21_bf16_to_float(out[i]),
+                            tanh(s21_bf16_to_float(in[i])), 8e-3);
+  s21_log_bf16_n(in + 2, out, 3);
+  for (int i = 0; i < 3; i++)
+    ck_assert_double_eq_tol(s21_bf16_to_float(out[i]),
+                            log(s21_bf16_to_float(in[i + 2])), 3e-2);
+}
+END_TEST
+
+START_TEST(test_f16_batch_long) {
+  // больше одного внутреннего блока
+  static uint16_t in[1000], out[1000];
+  for (int i = 0; i < 1000; i++) in[i] = s21_float_to_f16(i / 100.0f - 5);
+  s21_exp_f16_n(in, out, 1000);
+  for (int i = 0; i < 1000; i++) {
+    double e = exp(s21_f16_to_float(in[i]));
+    ck_assert_double_eq_tol(s21_f16_to_float(out[i]), e, e * 1e-3);
+  }
+}
+END_TEST
+
+// Test case for the lookup-table mode
+START_TEST(test_lut_linear_sin) {
+  s21_lut *lut = s21_lut_create(s21_sin, 0, 2 * S21_PI, 1024, S21_LUT_LINEAR);
+  ck_assert_ptr_nonnull(lut);
+  double err = s21_lut_max_error(lut);
+  ck_assert(err > 0 && err < 1e-5);
+  for (int i = 0; i <= 1000; i++) {
+    double x = i * 2 * S21_PI / 1000;
+    ck_assert_double_eq_tol(s21_lut_eval(lut, x), sin(x), err * 1.01);
+  }
+  ck_assert_int_eq(s21_lut_memory(lut) >= 1024 * sizeof(double), 1);
+  s21_lut_free(lut);
+}
+END_TEST
+
+START_TEST(test_lut_interp_orders) {
+  s21_lut *nearest = s21_lut_create(s21_exp, -1, 1, 256, S21_LUT_NEAREST);
+  s21_lut *linear = s21_lut_create(s21_exp, -1, 1, 256, S21_LUT_LINEAR);
+  s21_lut *cubic = s21_lut_create(s21_exp, -1, 1, 256, S21_LUT_CUBIC);
+  ck_assert(s21_lut_max_error(nearest) > s21_lut_max_error(linear));
+  ck_assert(s21_lut_max_error(linear) > s21_lut_max_error(cubic));
+  ck_assert(s21_lut_max_error(cubic) < 1e-8);
+  // узлы воспроизводятся точно
+  ck_assert_double_eq_tol(s21_lut_eval(cubic, 1.0), exp(1.0), 1e-12);
+  ck_assert_double_eq_tol(s21_lut_eval(nearest, -1.0), exp(-1.0), 1e-12);
+  s21_lut_free(nearest);
+  s21_lut_free(linear);
+  s21_lut_free(cubic);
+}
+END_TEST
+
+START_TEST(test_lut_clamp_and_batch) {
+  s21_lut *lut = s21_lut_create(s21_cos, 0, S21_PI, 512, S21_LUT_CUBIC);
+  double x[4] = {-1.0, 0.5, 2.0, 10.0};
+  double res[4];
+  s21_lut_eval_n(lut, x, res, 4);
+  ck_assert_double_eq_tol(res[0], 1.0, 1e-9);
+  ck_assert_double_eq_tol(res[1], cos(0.5), 1e-9);
+  ck_assert_double_eq_tol(res[2], cos(2.0), 1e-9);
+  ck_assert_double_eq_tol(res[3], -1.0, 1e-9);
+  // NaN не прижимается к краю
+  x[1] = NAN;
+  s21_lut_eval_n(lut, x, res, 4);
+  ck_assert_double_nan(res[1]);
+  ck_assert_double_eq_tol(res[2], cos(2.0), 1e-9);
+  ck_assert_double_nan(s21_lut_eval(lut, NAN));
+  s21_lut_free(lut);
+}
+END_TEST
+
+START_TEST(test_lut_invalid) {
+  ck_assert_ptr_null(s21_lut_create(NULL, 0, 1, 256, S21_LUT_LINEAR));
+  ck_assert_ptr_null(s21_lut_create(s21_sin, 1, 0, 256, S21_LUT_LINEAR));
+  ck_assert_ptr_null(s21_lut_create(s21_sin, 0, 1, 2, S21_LUT_LINEAR));
+  s21_lut_free(NULL);
+}
+END_TEST
+
+// Test case for the strided batch functions
+START_TEST(test_strided_aos) {
+  struct particle {
+    double x, y, angle;
+  } p[300];
+  double res[300];
+  for (int i = 0; i < 300; i++) p[i].angle = i * 0.01;
+  s21_sin_strided(&p[0].angle, 3, res, 1, 300);
+  for (int i = 0; i < 300; i++)
+    ck_assert_double_eq(res[i], (double)s21_sin(p[i].angle));
+  s21_cos_strided(&p[0].angle, 3, &p[0].y, 3, 300);
+  for (int i = 0; i < 300; i++)
+    ck_assert_double_eq(p[i].y, (double)s21_cos(p[i].angle));
+}
+END_TEST
+
+START_TEST(test_strided_in_place) {
+  double xyz[3 * 200];
+  for (int i = 0; i < 3 * 200; i++) xyz[i] = i + 1;
+  s21_sqrt_strided(xyz + 1, 3, xyz + 1, 3, 200);
+  for (int i = 0; i < 200; i++) {
+    ck_assert_double_eq(xyz[3 * i], 3 * i + 1);
+    ck_assert_double_eq(xyz[3 * i + 1], sqrt(3 * i + 2));
+    ck_assert_double_eq(xyz[3 * i + 2], 3 * i + 3);
+  }
+  double v[4] = {1.0, 2.0, 4.0, 8.0};
+  s21_log2_strided(v, 1, v, 1, 4);
+  for (int i = 0; i < 4; i++) ck_assert_double_eq(v[i], i);
+}
+END_TEST
+
+START_TEST(test_strided_negative) {
+  double x[4] = {1.0, 2.0, 3.0, 4.0};
+  double res[4];
+  // обход в обратном порядке
+  s21_exp_strided(x + 3, -1, res, 1, 4);
+  for (int i = 0; i < 4; i++)
+    ck_assert_double_eq(res[i], (double)s21_exp(x[3 - i]));
+}
+END_TEST
+
+START_TEST(test_strided_binary) {
+  double data[2 * 5] = {2, 3, 4, 0.5, 9, 2, 1.5, 2, 10, -1};
+  double res[5];
+  s21_pow_strided(data, 2, data + 1, 2, res, 1, 5);
+  for (int i = 0; i < 5; i++)
+    ck_assert_double_eq(res[i], (double)s21_pow(data[2 * i], data[2 * i + 1]));
+  s21_fmod_strided(data, 2, data + 1, 2, data, 2, 5);
+  ck_assert_double_eq_tol(data[0], 2.0, TOLERANCE);
+  ck_assert_double_eq_tol(data[2], 0.0, TOLERANCE);
+  ck_assert_double_eq_tol(data[6], 1.5, TOLERANCE);
+}
+END_TEST
+
+// Test case for the exp reductions
+START_TEST(test_logsumexp_values) {
+  double x[3] = {1.0, 2.0, 3.0};
+  ck_assert_double_eq_tol(s21_logsumexp(x, 3),
+                          log(exp(1.0) + exp(2.0) + exp(3.0)), 1e-14);
+  // s21_exp(1000) переполняется, а logsumexp — нет
+  double big[2] = {1000.0, 1000.0};
+  ck_assert_double_eq_tol(s21_logsumexp(big, 2), 1000 + log(2.0), 1e-12);
+  double tiny[2] = {-1000.0, -1001.0};
+  ck_assert_double_eq_tol(s21_logsumexp(tiny, 2), -1000 + log1p(exp(-1.0)),
+                          1e-12);
+}
+END_TEST
+
+START_TEST(test_logsumexp_special_cases) {
+  double x[3] = {1.0, -INFINITY, 2.0};
+  ck_assert_double_eq_tol(s21_logsumexp(x, 3), log(exp(1.0) + exp(2.0)),
+                          1e-14);
+  ck_assert_double_eq(s21_logsumexp(x, 0), -INFINITY);
+  x[1] = INFINITY;
+  ck_assert_double_eq(s21_logsumexp(x, 3), INFINITY);
+  x[1] = NAN;
+  ck_assert(isnan(s21_logsumexp(x, 3)));
+}
+END_TEST
+
+START_TEST(test_sum_exp_values) {
+  double x[4] = {0.0, 1.0, -1.0, 0.5};
+  ck_assert_double_eq_tol(s21_sum_exp(x, 4),
+                          1 + exp(1.0) + exp(-1.0) + exp(0.5), 1e-14);
+  double big[2] = {710.0, 0.0};
+  ck_assert_double_eq((double)s21_sum_exp(big, 2), INFINITY);
+}
+END_TEST
+
+START_TEST(test_softmax_values) {
+  double x[4] = {1000.0, 1001.0, 999.0, 1000.0};
+  double res[4];
+  s21_softmax(x, res, 4);
+  double total = exp(0.0) + exp(1.0) + exp(-1.0) + exp(0.0);
+  ck_assert_double_eq_tol(res[0], 1 / total, 1e-15);
+  ck_assert_double_eq_tol(res[1], exp(1.0) / total, 1e-15);
+  ck_assert_double_eq_tol(res[2], exp(-1.0) / total, 1e-15);
+  // на месте
+  s21_softmax(x, x, 4);
+  for (int i = 0; i < 4; i++) ck_assert_double_eq(x[i], res[i]);
+}
+END_TEST
+
+START_TEST(test_reduce_threads_deterministic) {
+  size_t n = 100000;
+  double *x = malloc(n * sizeof(double));
+  double *r1 = malloc(n * sizeof(double));
+  double *r4 = malloc(n * sizeof(double));
+  for (size_t i = 0; i < n; i++) x[i] = (double)(i % 1000) / 10 - 50;
+  s21_set_threads(1);
+  long double lse1 = s21_logsumexp(x, n);
+  s21_softmax(x, r1, n);
+  s21_set_threads(4);
+  ck_assert_int_eq(s21_get_threads(), 4);
+  long double lse4 = s21_logsumexp(x, n);
+  s21_softmax(x, r4, n);
+  s21_set_threads(1);
+  ck_assert(lse1 == lse4);
+  double sum = 0;
+  for (size_t i = 0; i < n; i++) {
+    ck_assert(r1[i] == r4[i]);
+    sum += r1[i];
+  }
+  ck_assert_double_eq_tol(sum, 1.0, 1e-12);
+  free(x);
+  free(r1);
+  free(r4);
+}
+END_TEST
+
+typedef struct {
+  const double *x;
+  size_t n;
+  long double res[50];
+} reduce_caller;
+
+static void *reduce_thread(void *arg) {
+  reduce_caller *c = arg;
+  for (int i = 0; i < 50; i++) c->res[i] = s21_logsumexp(c->x, c->n);
+  return NULL;
+}
+
+START_TEST(test_reduce_pool_shared) {
+  // потоки пула переиспользуются между вызовами; одновременный вызов из
+  // другого потока считает свои куски сам и получает тот же результат
+  size_t n = 70000;
+  double *x = malloc(n * sizeof(double));
+  for (size_t i = 0; i < n; i++) x[i] = (double)(i % 777) / 7 - 60;
+  long double serial = s21_logsumexp(x, n);
+  s21_set_threads(4);
+  reduce_caller c[2] = {{x, n, {0}}, {x, n, {0}}};
+  pthread_t tid;
+  ck_assert_int_eq(pthread_create(&tid, NULL, reduce_thread, &c[0]), 0);
+  reduce_thread(&c[1]);
+  pthread_join(tid, NULL);
+  s21_set_threads(1);
+  for (int i = 0; i < 50; i++) {
+    ck_assert(c[0].res[i] == serial);
+    ck_assert(c[1].res[i] == serial);
+  }
+  free(x);
+}
+END_TEST
+
+// Test case for the summation functions
+START_TEST(test_fsum_compensated) {
+  double x[4] = {1e100, 1.0, -1e100, 1.0};
+  ck_assert_double_eq(s21_fsum(x, 4, S21_SUM_COMPENSATED), 2.0);
+  size_t n = 1000000;
+  double *v = malloc(n * sizeof(double));
+  for (size_t i = 0; i < n; i++) v[i] = 0.1;
+  ck_assert_double_eq_tol(s21_fsum(v, n, S21_SUM_COMPENSATED), 100000.0,
+                          1e-10);
+  ck_assert_double_eq_tol(s21_fsum(v, n, S21_SUM_FAST), 100000.0, 1e-6);
+  free(v);
+}
+END_TEST
+
+START_TEST(test_dot_values) {
+  double x[3] = {1e16, 1.0, -1e16};
+  double y[3] = {1.0, 1.0, 1.0};
+  ck_assert_double_eq(s21_dot(x, y, 3, S21_SUM_COMPENSATED), 1.0);
+  double a[5] = {1, 2, 3, 4, 5};
+  double b[5] = {5, 4, 3, 2, 1};
+  ck_assert_double_eq(s21_dot(a, b, 5, S21_SUM_FAST), 35.0);
+  ck_assert_double_eq(s21_dot(a, b, 5, S21_SUM_COMPENSATED), 35.0);
+  ck_assert_double_eq(s21_dot(a, b, 0, S21_SUM_COMPENSATED), 0.0);
+}
+END_TEST
+
+START_TEST(test_norm2_values) {
+  double x[2] = {3.0, 4.0};
+  ck_assert_double_eq(s21_norm2(x, 2, S21_SUM_FAST), 5.0);
+  ck_assert_double_eq(s21_norm2(x, 2, S21_SUM_COMPENSATED), 5.0);
+  double big[2] = {3e200, 4e200};
+  ck_assert_double_eq_tol(s21_norm2(big, 2, S21_SUM_COMPENSATED) / 1e200, 5.0,
+                          1e-14);
+  double small[2] = {3e-200, 4e-200};
+  ck_assert_double_eq_tol(s21_norm2(small, 2, S21_SUM_FAST) * 1e200, 5.0,
+                          1e-14);
+  ck_assert(isnan(s21_norm2((double[]){NAN, 1.0}, 2, S21_SUM_FAST)));
+}
+END_TEST
+
+START_TEST(test_sum_threads_deterministic) {
+  size_t n = 300001;
+  double *x = malloc(n * sizeof(double));
+  for (size_t i = 0; i < n; i++) x[i] = 1.0 / (double)(i + 1);
+  long double r1 = s21_fsum(x, n, S21_SUM_COMPENSATED);
+  long double d1 = s21_dot(x, x, n, S21_SUM_COMPENSATED);
+  s21_set_threads(3);
+  long double r3 = s21_fsum(x, n, S21_SUM_COMPENSATED);
+  long double d3 = s21_dot(x, x, n, S21_SUM_COMPENSATED);
+  s21_set_threads(1);
+  ck_assert(r1 == r3);
+  ck_assert(d1 == d3);
+  free(x);
+}
+END_TEST
+
+// Test case for the special functions
+START_TEST(test_erf_values) {
+  for (volatile double x = -6; x <= 6; x += 0.37) {
+    ck_assert_double_eq_tol(s21_erf(x), erf(x), 1e-15);
+    ck_assert_double_eq_tol(s21_erfc(x) / erfc(x), 1.0, 1e-13);
+  }
+  // erfc на (-2.5, 2.5) считается без вычитания 1 - erf
+  double worst = 0;
+  for (int i = 0; i <= 20000; i++) {
+    double x = -2.5 + i * 0.00025;
+    worst = fmax(worst, double_ulps(s21_erfc(x), erfcl(x)));
+  }
+  ck_assert_double_lt(worst, 1);
+  ck_assert_double_eq(s21_erf(INFINITY), 1.0);
+  ck_assert_double_eq(s21_erfc(INFINITY), 0.0);
+  ck_assert(isnan(s21_erf(NAN)));
+}
+END_TEST
+
+START_TEST(test_tgamma_values) {
+  for (volatile double x = -9.75; x <= 170; x += 0.5) {
+    ck_assert_double_eq_tol(s21_tgamma(x) / tgamma(x), 1.0, 1e-13);
+  }
+  double worst = 0;
+  for (int i = 0; i <= 40000; i++) {
+    double x = -29.99 + i * 0.005013;
+    if (x != floor(x)) {
+      worst = fmax(worst, double_ulps(s21_tgamma(x), tgammal(x)));
+    }
+  }
+  ck_assert_double_lt(worst, 2);
+  ck_assert_double_eq(s21_tgamma(5), 24.0);
+  ck_assert_double_eq(s21_tgamma(21), 2432902008176640000.0);
+  ck_assert(isinf(s21_tgamma(0)));
+  ck_assert(isinf(s21_tgamma(200)));
+  ck_assert(isnan(s21_tgamma(-3)));
+}
+END_TEST
+
+START_TEST(test_lgamma_values) {
+  for (volatile double x = -9.75; x <= 1000; x += 1.3) {
+    ck_assert_double_eq_tol(s21_lgamma(x), lgamma(x),
+                            1e-13 * (fabs(lgamma(x)) + 1));
+  }
+  // ulp-границы, в том числе у корней 1 и 2 и для отрицательных x
+  double worst = 0;
+  for (int i = 0; i <= 40000; i++) {
+    double x = -12.99 + i * 0.001071;
+    if (x != floor(x)) {
+      worst = fmax(worst, double_ulps(s21_lgamma(x), lgammal(x)));
+    }
+  }
+  double near_roots[6] = {1 - 1e-9, 1 + 3e-12, 2 - 1e-7,
+                          2 + 1e-15, -30.1,     -157.6};
+  for (int i = 0; i < 6; i++) {
+    worst = fmax(worst, double_ulps(s21_lgamma(near_roots[i]),
+                                    lgammal(near_roots[i])));
+  }
+  ck_assert_double_lt(worst, 1);
+  ck_assert_double_eq(s21_lgamma(1), 0.0);
+  ck_assert_double_eq(s21_lgamma(2), 0.0);
+  ck_assert(isinf(s21_lgamma(-2)));
+  ck_assert_double_eq_tol(s21_lgamma(1e300), lgamma(1e300), 1e287);
+}
+END_TEST
+
+START_TEST(test_special_batch) {
+  double x[5] = {-2.5, -0.5, 0.5, 3.0, 7.25};
+  double res[5];
+  s21_erf_n(x, res, 5);
+  for (int i = 0; i < 5; i++)
+    ck_assert_double_eq(res[i], (double)s21_erf(x[i]));
+  s21_erfc_n(x, res, 5);
+  for (int i = 0; i < 5; i++)
+    ck_assert_double_eq(res[i], (double)s21_erfc(x[i]));
+  s21_tgamma_n(x, res, 5);
+  for (int i = 0; i < 5; i++)
+    ck_assert_double_eq(res[i], (double)s21_tgamma(x[i]));
+  s21_lgamma_n(x, res, 5);
+  for (int i = 0; i < 5; i++)
+    ck_assert_double_eq(res[i], (double)s21_lgamma(x[i]));
+}
+END_TEST
+
+// Test case for the random sampling
+START_TEST(test_philox_known_answer) {
+  uint32_t ctr[4] = {0, 0, 0, 0};
+  uint32_t key[2] = {0, 0};
+  uint32_t out[4];
+  s21_philox4x32(ctr, key, out);
+  ck_assert_uint_eq(out[0], 0x6627e8d5u);
+  ck_assert_uint_eq(out[1], 0xe169c58du);
+  ck_assert_uint_eq(out[2], 0xbc57ac4cu);
+  ck_assert_uint_eq(out[3], 0x9b00dbd8u);
+  uint32_t ctr2[4] = {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu};
+  uint32_t key2[2] = {0xffffffffu, 0xffffffffu};
+  s21_philox4x32(ctr2, key2, out);
+  ck_assert_uint_eq(out[0], 0x408f276du);
+  ck_assert_uint_eq(out[1], 0x41c83b0eu);
+  ck_assert_uint_eq(out[2], 0xa20bc7c6u);
+  ck_assert_uint_eq(out[3], 0x6d5451fdu);
+}
+END_TEST
+
+START_TEST(test_randn_moments) {
+  size_t n = 1000000;
+  double *v = malloc(n * sizeof(double));
+  s21_rng rng;
+  s21_rng_init(&rng, 42, 0);
+  s21_randn_n(&rng, v, n);
+  long double m1 = 0, m2 = 0, m4 = 0;
+  for (size_t i = 0; i < n; i++) {
+    m1 += v[i];
+    m2 += (long double)v[i] * v[i];
+    m4 += (long double)v[i] * v[i] * v[i] * v[i];
+  }
+  ck_assert_double_eq_tol(m1 / n, 0.0, 5e-3);
+  ck_assert_double_eq_tol(m2 / n, 1.0, 5e-3);
+  ck_assert_double_eq_tol(m4 / n, 3.0, 3e-2);
+  s21_rande_n(&rng, v, n);
+  m1 = 0;
+  m2 = 0;
+  for (size_t i = 0; i < n; i++) {
+    ck_assert(v[i] > 0);
+    m1 += v[i];
+    m2 += (long double)v[i] * v[i];
+  }
+  ck_assert_double_eq_tol(m1 / n, 1.0, 5e-3);
+  ck_assert_double_eq_tol(m2 / n, 2.0, 2e-2);
+  free(v);
+}
+END_TEST
+
+START_TEST(test_rand_uniform_range) {
+  double v[1001];
+  s21_rng rng;
+  s21_rng_init(&rng, 7, 3);
+  s21_rand_n(&rng, v, 1001);
+  long double sum = 0;
+  for (int i = 0; i < 1001; i++) {
+    ck_assert(v[i] > 0 && v[i] < 1);
+    // (k + 1/2) 2^-52 точно, в том числе в верхней половине отрезка
+    ck_assert_double_eq(fmod(ldexp(v[i], 53), 2), 1);
+    sum += v[i];
+  }
+  ck_assert_double_eq_tol(sum / 1001, 0.5, 0.03);
+  ck_assert_uint_eq(rng.counter, 501);
+}
+END_TEST
+
+START_TEST(test_rand_streams_deterministic) {
+  size_t n = 100000;
+  double *a = malloc(n * sizeof(double));
+  double *b = malloc(n * sizeof(double));
+  s21_rng rng;
+  s21_rng_init(&rng, 1, 0);
+  s21_randn_n(&rng, a, n);
+  // тот же поток по частям и в четыре потока даёт те же значения
+  s21_rng_init(&rng, 1, 0);
+  s21_set_threads(4);
+  s21_randn_n(&rng, b, 1000);
+  s21_randn_n(&rng, b + 1000, n - 1000);
+  s21_set_threads(1);
+  ck_assert_mem_eq(a, b, n * sizeof(double));
+  // другой поток — другая последовательность
+  s21_rng_init(&rng, 1, 1);
+  s21_randn_n(&rng, b, n);
+  size_t same = 0;
+  for (size_t i = 0; i < n; i++) same += a[i] == b[i];
+  ck_assert_uint_lt(same, 10);
+  free(a);
+  free(b);
+}
+END_TEST
+
+// Test case for the autotuner
+START_TEST(test_tune_override) {
+  ck_assert_str_eq(s21_tune_candidates(S21_TUNE_RSQRT), "simd scalar fast");
+  ck_assert_str_eq(s21_tune_get(S21_TUNE_LOG), "series");
+  ck_assert_int_eq(s21_tune_set(S21_TUNE_RSQRT, "fast"), 0);
+  ck_assert_str_eq(s21_tune_get(S21_TUNE_RSQRT), "fast");
+  double x[3] = {0.25, 2.0, 1e10};
+  double res[3];
+  s21_rsqrt_n(x, res, 3);
+  for (int i = 0; i < 3; i++) {
+    ck_assert_double_eq(res[i], (double)s21_rsqrt_fast(x[i]));
+  }
+  ck_assert_int_eq(s21_tune_set(S21_TUNE_RSQRT, "bogus"), -1);
+  ck_assert_str_eq(s21_tune_get(S21_TUNE_RSQRT), "fast");
+  ck_assert_int_eq(s21_tune_set(S21_TUNE_RSQRT, "simd"), 0);
+}
+END_TEST
+
+START_TEST(test_tune_budget) {
+  ck_assert_double_eq(s21_tune_get_budget(S21_TUNE_LOG), 1.0);
+  ck_assert_int_eq(s21_tune(NULL), 0);
+  // ряд для log теряет точность на малых аргументах и в бюджет не проходит
+  ck_assert_str_eq(s21_tune_get(S21_TUNE_LOG), "table");
+  ck_assert_str_ne(s21_tune_get(S21_TUNE_RSQRT), "fast");
+  double x[4] = {1e-300, 0.25, 3.0, 1e300};
+  double res[4];
+  s21_log_n(x, res, 4);
+  for (int i = 0; i < 4; i++) {
+    ck_assert_double_eq_tol(res[i] / log(x[i]), 1, 1e-15);
+  }
+  s21_tune_set(S21_TUNE_LOG, "series");
+  s21_tune_set(S21_TUNE_SIN, "poly");
+  s21_tune_set(S21_TUNE_COS, "poly");
+  s21_tune_set(S21_TUNE_SQRT, "simd");
+}
+END_TEST
+
+START_TEST(test_tune_special_values) {
+  // при большом бюджете может победить sinpi, но NaN, бесконечности и
+  // огромные аргументы она обязана считать как s21_sin/s21_cos
+  double x[8] = {NAN, 0.0, -0.0, 5e-324, 1e17, 1e300, -1e300, INFINITY};
+  double s[8], c[8];
+  s21_tune_set_budget(S21_TUNE_SIN, 1e6);
+  s21_tune_set_budget(S21_TUNE_COS, 1e6);
+  ck_assert_int_eq(s21_tune(NULL), 0);
+  for (int k = 0; k < 2; k++) {
+    s21_sin_n(x, s, 8);
+    s21_cos_n(x, c, 8);
+    for (int i = 0; i < 8; i++) {
+      double rs = (double)s21_sin(x[i]), rc = (double)s21_cos(x[i]);
+      if (isnan(rs)) {
+        ck_assert_double_nan(s[i]);
+      } else {
+        ck_assert_double_eq_tol(s[i], rs, 1e-15);
+      }
+      if (isnan(rc)) {
+        ck_assert_double_nan(c[i]);
+      } else {
+        ck_assert_double_eq_tol(c[i], rc, 1e-15);
+      }
+    }
+    s21_tune_set(S21_TUNE_SIN, "sinpi");
+    s21_tune_set(S21_TUNE_COS, "sinpi");
+  }
+  s21_tune_set_budget(S21_TUNE_SIN, 1);
+  s21_tune_set_budget(S21_TUNE_COS, 1);
+  s21_tune_set(S21_TUNE_LOG, "series");
+  s21_tune_set(S21_TUNE_SIN, "poly");
+  s21_tune_set(S21_TUNE_COS, "poly");
+  s21_tune_set(S21_TUNE_SQRT, "simd");
+}
+END_TEST
+
+START_TEST(test_tune_cache) {
+  const char *path = "s21_tune_test.txt";
+  s21_tune_set(S21_TUNE_SQRT, "scalar");
+  ck_assert_int_eq(s21_tune(path), 0);
+  s21_tune_set(S21_TUNE_LOG, "series");
+  s21_tune_set(S21_TUNE_SQRT, "scalar");
+  ck_assert_int_eq(s21_tune_load(path), 0);
+  ck_assert_str_eq(s21_tune_get(S21_TUNE_LOG), "table");
+  // файл с другой моделью процессора не принимается
+  FILE *f = fopen(path, "w");
+  fprintf(f, "s21_tune 1\ncpu other\n");
+  fclose(f);
+  s21_tune_set(S21_TUNE_LOG, "series");
+  ck_assert_int_eq(s21_tune_load(path), -1);
+  ck_assert_str_eq(s21_tune_get(S21_TUNE_LOG), "series");
+  ck_assert_int_eq(s21_tune_load("no/such/file"), -1);
+  remove(path);
+  s21_tune_set(S21_TUNE_LOG, "series");
+  s21_tune_set(S21_TUNE_SIN, "poly");
+  s21_tune_set(S21_TUNE_COS, "poly");
+  s21_tune_set(S21_TUNE_SQRT, "simd");
+}
+END_TEST
+
+// Test case for the Chebyshev approximation
+START_TEST(test_cheb_tolerance) {
+  s21_cheb *c = s21_cheb_create(s21_lgamma, 0.5, 20, 1e-12, 12);
+  ck_assert_ptr_nonnull(c);
+  double err = s21_cheb_max_error(c);
+  ck_assert(err <= 1e-12);
+  for (int i = 0; i <= 1000; i++) {
+    double x = 0.5 + i * 19.5 / 1000;
+    ck_assert_double_eq_tol(s21_cheb_eval(c, x), lgamma(x), 2e-12);
+  }
+  ck_assert_int_le(s21_cheb_degree(c), 12);
+  ck_assert_int_ge(s21_cheb_segments(c), 1);
+  // пакет совпадает со скалярным вычислением и при перемешанных частях
+  double x[600], res[600];
+  for (int i = 0; i < 600; i++) x[i] = i % 3 ? 0.5 + i * 0.0325 : 20 - i * 0.03;
+  s21_cheb_eval_n(c, x, res, 600);
+  for (int i = 0; i < 600; i++) {
+    ck_assert_double_eq(res[i], s21_cheb_eval(c, x[i]));
+  }
+  s21_cheb_free(c);
+}
+END_TEST
+
+START_TEST(test_cheb_degree_and_segments) {
+  // при низкой допустимой степени точность набирается числом частей
+  s21_cheb *c = s21_cheb_create(s21_cbrt, 1, 8, 1e-10, 16);
+  s21_cheb *p = s21_cheb_create(s21_expm1, -1, 1, 1e-14, 4);
+  ck_assert(s21_cheb_max_error(c) <= 1e-10);
+  ck_assert(s21_cheb_max_error(p) <= 1e-14);
+  ck_assert_int_gt(s21_cheb_segments(p), 1);
+  ck_assert_int_eq(s21_cheb_degree(p), 4);
+  ck_assert(s21_cheb_memory(p) > s21_cheb_memory(c) / 1000);
+  s21_cheb_free(c);
+  s21_cheb_free(p);
+}
+END_TEST
+
+START_TEST(test_cheb_save_load) {
+  s21_cheb *c = s21_cheb_create(s21_erf, -3, 3, 1e-13, 10);
+  size_t size = s21_cheb_save(c, NULL, 0);
+  unsigned char *buf = malloc(size);
+  ck_assert_uint_eq(s21_cheb_save(c, buf, size), size);
+  s21_cheb *d = s21_cheb_load(buf, size);
+  ck_assert_ptr_nonnull(d);
+  ck_assert_double_eq(s21_cheb_max_error(d), s21_cheb_max_error(c));
+  double x[5] = {-5, -1.25, 0, 0.7, 3}, r1[5], r2[5];
+  s21_cheb_eval_n(c, x, r1, 5);
+  s21_cheb_eval_n(d, x, r2, 5);
+  for (int i = 0; i < 5; i++) {
+    ck_assert_double_eq(r1[i], r2[i]);
+    ck_assert_double_eq_tol(r1[i], erf(i == 0 ? -3 : x[i]), 1e-13);
+  }
+  // NaN не прижимается к краю, в том числе на месте
+  x[2] = NAN;
+  s21_cheb_eval_n(c, x, x, 5);
+  ck_assert_double_nan(x[2]);
+  ck_assert_double_eq(x[1], r1[1]);
+  ck_assert_double_eq(x[4], r1[4]);
+  ck_assert_double_nan(s21_cheb_eval(c, NAN));
+  ck_assert_ptr_null(s21_cheb_load(buf, size - 1));
+  buf[0] = 'X';
+  ck_assert_ptr_null(s21_cheb_load(buf, size));
+  s21_cheb_free(c);
+  s21_cheb_free(d);
+  free(buf);
+}
+END_TEST
+
+START_TEST(test_cheb_invalid) {
+  ck_assert_ptr_null(s21_cheb_create(NULL, 0, 1, 1e-6, 8));
+  ck_assert_ptr_null(s21_cheb_create(s21_exp, 1, 0, 1e-6, 8));
+  ck_assert_ptr_null(s21_cheb_create(s21_exp, 0, 1, 0, 8));
+  ck_assert_ptr_null(s21_cheb_create(s21_exp, 0, 1, 1e-6, 17));
+  s21_cheb_free(NULL);
+}
+END_TEST
+
+// Test case for the polynomial engine
+START_TEST(test_polyval_schemes) {
+  double c[13];
+  for (int i = 0; i < 13; i++) c[i] = 1.0 / (i + 1) * (i % 3 ? 1 : -1);
+  s21_poly_scheme schemes[3] = {S21_POLY_HORNER, S21_POLY_ESTRIN,
+                                S21_POLY_FMA};
+  for (int d = 0; d <= 12; d++) {
+    for (double x = -1.5; x <= 1.5; x += 0.25) {
+      long double ref = 0;
+      for (int i = d; i >= 0; i--) ref = ref * x + c[i];
+      for (int s = 0; s < 3; s++) {
+        ck_assert_double_eq_tol(s21_polyval(c, d, x, schemes[s]), ref,
+                                1e-13);
+      }
+    }
+  }
+  ck_assert_double_eq(s21_polyval(c, -1, 2.0, S21_POLY_HORNER), 0.0);
+}
+END_TEST
+
+START_TEST(test_polyval_batch_matches_scalar) {
+  double c[9] = {1, -2, 0.5, 3, -0.25, 1.5, 0.125, -1, 0.0625};
+  double x[37], res[37];
+  for (int i = 0; i < 37; i++) x[i] = -2 + i * 0.11;
+  s21_poly_scheme schemes[3] = {S21_POLY_HORNER, S21_POLY_ESTRIN,
+                                S21_POLY_FMA};
+  for (int s = 0; s < 3; s++) {
+    for (int d = 0; d <= 8; d++) {
+      s21_polyval_n(c, d, x, res, 37, schemes[s]);
+      for (int i = 0; i < 37; i++) {
+        ck_assert_double_eq(res[i], s21_polyval(c, d, x[i], schemes[s]));
+      }
+    }
+  }
+}
+END_TEST
+
+START_TEST(test_ratval_values) {
+  // Паде [2/2] для e^x
+  double p[3] = {1, 0.5, 1.0 / 12};
+  double q[3] = {1, -0.5, 1.0 / 12};
+  double x[10], res[10];
+  for (int i = 0; i < 10; i++) x[i] = -0.1 + i * 0.02;
+  s21_ratval_n(p, 2, q, 2, x, res, 10, S21_POLY_ESTRIN);
+  for (int i = 0; i < 10; i++) {
+    ck_assert_double_eq(res[i], s21_ratval(p, 2, q, 2, x[i], S21_POLY_ESTRIN));
+    ck_assert_double_eq_tol(res[i], exp(x[i]), 1e-7);
+  }
+}
+END_TEST
+
+START_TEST(test_poly_kernels_accuracy) {
+  for (volatile double x = -1000; x <= 1000; x += 0.731) {
+    ck_assert_double_eq_tol(s21_sin(x), sin(x), 1e-15);
+    ck_assert_double_eq_tol(s21_cos(x), cos(x), 1e-15);
+    ck_assert_double_eq_tol(s21_atan(x), atan(x), 1e-15);
+  }
+  for (volatile double x = -700; x <= 700; x += 0.917) {
+    ck_assert_double_eq_tol(s21_exp(x) / exp(x), 1, 1e-15);
+  }
+  ck_assert_double_eq_tol(s21_atan(0.99), atan(0.99), 1e-16);
+}
+END_TEST
+
+START_TEST(test_tgmath_selects_by_type) {
+  // float -> float, long double -> long double, double и int -> исходные
+  ck_assert_int_eq(_Generic(s21_sin(0.5f), float: 1, default: 0), 1);
+  ck_assert_int_eq(_Generic(s21_exp(0.5L), long double: 1, default: 0), 1);
+  ck_assert_int_eq(_Generic(s21_sqrt(2), long double: 1, default: 0), 1);
+  ck_assert_int_eq(_Generic(s21_fabs(-2.0), long double: 1, default: 0), 1);
+  ck_assert(s21_sin(0.5f) == s21_sinf(0.5f));
+  ck_assert(s21_log(3.0L) == s21_logl(3.0L));
+  ck_assert(s21_cos(0.5) == s21_cosl(0.5));
+}
+END_TEST
+
+// погрешность в ULP float относительно ref, посчитанного в double
+static double float_ulps(float v, double ref) {
+  float r = (float)ref;
+  double ulp = fabs((double)nextafterf(r, INFINITY) - r);
+  return v == ref ? 0 : fabs(v - ref) / ulp;
+}
+
+START_TEST(test_float_kernels_accuracy) {
+  double worst = 0;
+  for (int i = 0; i <= 20000; i++) {
+    float t = (float)(-100 + i * 0.01);
+    float p = (float)exp(-100 + i * 0.0175);  // от 3.7e-44 до 1.6e33
+    worst = fmax(worst, float_ulps(s21_sinf(t), sin(t)));
+    worst = fmax(worst, float_ulps(s21_cosf(t), cos(t)));
+    worst = fmax(worst, float_ulps(s21_tanf(t), tan(t)));
+    worst = fmax(worst, float_ulps(s21_atanf(t), atan(t)));
+    worst = fmax(worst, float_ulps(s21_expf(t * 0.85f), exp(t * 0.85f)));
+    worst = fmax(worst, float_ulps(s21_exp2f(t), exp2(t)));
+    worst = fmax(worst, float_ulps(s21_logf(p), log(p)));
+    worst = fmax(worst, float_ulps(s21_log2f(p), log2(p)));
+    worst = fmax(worst, float_ulps(s21_log10f(p), log10(p)));
+    worst = fmax(worst, float_ulps(s21_sqrtf(p), sqrt(p)));
+    ck_assert(s21_floorf(t * 3.3f) == floorf(t * 3.3f));
+    ck_assert(s21_ceilf(t * 3.3f) == ceilf(t * 3.3f));
+  }
+  ck_assert_double_lt(worst, 1);
+}
+END_TEST
+
+START_TEST(test_float_kernels_special) {
+  ck_assert_float_nan(s21_sinf(NAN));
+  ck_assert_float_nan(s21_cosf(INFINITY));
+  ck_assert_float_nan(s21_logf(-1.0f));
+  ck_assert_float_nan(s21_sqrtf(-4.0f));
+  ck_assert(s21_logf(0.0f) == -INFINITY);
+  ck_assert(s21_expf(100.0f) == INFINITY);
+  ck_assert(s21_expf(-200.0f) == 0);
+  ck_assert(s21_atanf(-INFINITY) == -(float)(M_PI / 2));
+  ck_assert(s21_sqrtf(INFINITY) == INFINITY);
+  // большие аргументы до FLT_MAX приводятся точно
+  double worst = 0;
+  for (float x = 1e7f; x < FLT_MAX / 1.37f; x *= 1.37f) {
+    worst = fmax(worst, float_ulps(s21_sinf(x), sin(x)));
+    worst = fmax(worst, float_ulps(s21_cosf(-x), cos(x)));
+    worst = fmax(worst, float_ulps(s21_tanf(x), tan(x)));
+  }
+  worst = fmax(worst, float_ulps(s21_sinf(FLT_MAX), sin(FLT_MAX)));
+  worst = fmax(worst, float_ulps(s21_cosf(FLT_MAX), cos(FLT_MAX)));
+  ck_assert_double_lt(worst, 1);
+}
+END_TEST
+
+START_TEST(test_long_double_kernels) {
+  for (int i = 1; i <= 4000; i++) {
+    long double x = i * 0.0123L + 1e-15L;
+    ck_assert_ldouble_eq_tol(s21_sinl(x), sinl(x), 1e-18);
+    ck_assert_ldouble_eq_tol(s21_cosl(-x), cosl(-x), 1e-18);
+    ck_assert_ldouble_eq_tol(s21_atanl(x), atanl(x), 1e-18);
+    ck_assert_ldouble_eq_tol(s21_logl(x), logl(x), 1e-18);
+    ck_assert_ldouble_eq_tol(s21_log2l(x) / log2l(x), 1, 1e-17);
+    ck_assert_ldouble_eq_tol(s21_sqrtl(x) / sqrtl(x), 1, 1e-18);
+    ck_assert_ldouble_eq_tol(s21_expl(x - 25) / expl(x - 25), 1, 1e-17);
+  }
+  ck_assert(s21_floorl(-2.5L) == -3 && s21_ceill(-2.5L) == -2);
+  ck_assert(s21_fabsl(-1e-4000L) == 1e-4000L);
+}
+END_TEST
+
+// относительная погрешность комплексного результата
+static double complex_err(double complex a, double complex b) {
+  double m = cabs(b);
+  return m > 0 ? cabs(a - b) / m : cabs(a);
+}
+
+START_TEST(test_cexp_clog_values) {
+  double worst = 0;
+  for (int i = 0; i < 2000; i++) {
+    double complex z = CMPLX(-20 + i * 0.02, 30 - i * 0.031);
+    worst = fmax(worst, complex_err(s21_cexp(z), cexp(z)));
+    worst = fmax(worst, complex_err(s21_clog(z), clog(z)));
+  }
+  ck_assert_double_lt(worst, 1e-15);
+  // |z| около 1: действительная часть логарифма не теряет точность
+  double complex z = CMPLX(0.6, 0.8 + 1e-12);
+  ck_assert_double_eq_tol(creal(s21_clog(z)) / creal(clog(z)), 1, 1e-14);
+  ck_assert(s21_cexp(CMPLX(1, -0.0)) == CMPLX(exp(1), -0.0));
+  ck_assert(creal(s21_clog(CMPLX(0, 0))) == -INFINITY);
+  ck_assert_double_eq_tol(creal(s21_cexp(CMPLX(709.9, 1))),
+                          creal(cexp(CMPLX(709.9, 1))), 1e294);
+}
+END_TEST
+
+START_TEST(test_csqrt_cabs_carg) {
+  double worst = 0;
+  for (int i = 0; i < 2000; i++) {
+    double complex z = CMPLX(-50 + i * 0.05, 17 - i * 0.017);
+    worst = fmax(worst, complex_err(s21_csqrt(z), csqrt(z)));
+    worst = fmax(worst, fabs((double)s21_cabs(z) - cabs(z)) / cabs(z));
+    worst = fmax(worst, fabs((double)s21_carg(z) - carg(z)));
+  }
+  ck_assert_double_lt(worst, 1e-15);
+  // знак нуля мнимой части выбирает берег разреза
+  ck_assert(s21_csqrt(CMPLX(-4, -0.0)) == CMPLX(0, -2));
+  ck_assert_double_eq((double)s21_carg(CMPLX(-1, 0.0)), M_PI);
+  ck_assert_double_eq((double)s21_carg(CMPLX(-1, -0.0)), -M_PI);
+  ck_assert_double_eq((double)s21_cabs(CMPLX(3e307, 4e307)), 5e307);
+  ck_assert_double_eq((double)s21_cabs(CMPLX(3e-310, 4e-310)), 5e-310);
+}
+END_TEST
+
+START_TEST(test_csin_ccos_cpow) {
+  double worst = 0;
+  for (int i = 0; i < 2000; i++) {
+    double complex z = CMPLX(-10 + i * 0.01, 5 - i * 0.0052);
+    double complex w = CMPLX(0.5 - i * 0.001, i * 0.0007);
+    worst = fmax(worst, complex_err(s21_csin(z), csin(z)));
+    worst = fmax(worst, complex_err(s21_ccos(z), ccos(z)));
+    worst = fmax(worst, complex_err(s21_cpow(z, w), cpowl(z, w)));
+  }
+  ck_assert_double_lt(worst, 1e-15);
+  ck_assert(s21_cpow(CMPLX(0, 0), CMPLX(0, 0)) == 1);
+  ck_assert(s21_cpow(CMPLX(0, 0), CMPLX(2.5, 0)) == 0);
+  ck_assert(complex_err(s21_cpow(CMPLX(0, 1), CMPLX(2, 0)), -1) < 1e-16);
+  ck_assert(s21_csin(CMPLX(0, -0.0)) == CMPLX(0, -0.0));
+  // большие аргументы приводятся точно, как в s21_sin
+  ck_assert(complex_err(s21_cexp(CMPLX(0, 1e20)), cexp(CMPLX(0, 1e20))) <
+            1e-15);
+  ck_assert(complex_err(s21_csin(CMPLX(1e19, 0.5)), csin(CMPLX(1e19, 0.5))) <
+            1e-15);
+}
+END_TEST
+
+START_TEST(test_complex_batch_matches_scalar) {
+  double re[64], im[64], wr[64], wi[64], rr[64], ri[64], r[64];
+  for (int i = 0; i < 64; i++) {
+    re[i] = -3 + i * 0.1;
+    im[i] = 2 - i * 0.07;
+    wr[i] = 0.25 * i;
+    wi[i] = -0.5;
+  }
+  s21_cexp_n(re, im, rr, ri, 64);
+  for (int i = 0; i < 64; i++) {
+    ck_assert(CMPLX(rr[i], ri[i]) == s21_cexp(CMPLX(re[i], im[i])));
+  }
+  s21_ccos_n(re, im, rr, ri, 64);
+  for (int i = 0; i < 64; i++) {
+    ck_assert(CMPLX(rr[i], ri[i]) == s21_ccos(CMPLX(re[i], im[i])));
+  }
+  s21_cpow_n(re, im, wr, wi, rr, ri, 64);
+  for (int i = 0; i < 64; i++) {
+    double complex p = s21_cpow(CMPLX(re[i], im[i]), CMPLX(wr[i], wi[i]));
+    ck_assert(CMPLX(rr[i], ri[i]) == p);
+  }
+  s21_carg_n(re, im, r, 64);
+  for (int i = 0; i < 64; i++) {
+    ck_assert(r[i] == (double)s21_carg(CMPLX(re[i], im[i])));
+  }
+}
+END_TEST
+
+START_TEST(test_classify_values) {
+  double x[9] = {1.5,  -0.0,      0.0,  4.9e-324, -1e-310,
+                 NAN, -INFINITY, -2.0, 3e300};
+  unsigned char cls[9];
+  int expected[9] = {S21_FP_NORMAL,    S21_FP_ZERO,      S21_FP_ZERO,
+                     S21_FP_SUBNORMAL, S21_FP_SUBNORMAL, S21_FP_NAN,
+                     S21_FP_INFINITE,  S21_FP_NORMAL,    S21_FP_NORMAL};
+  unsigned mask = s21_classify_n(x, cls, 9);
+  for (int i = 0; i < 9; i++) {
+    ck_assert_int_eq(cls[i], expected[i]);
+    ck_assert_int_eq(s21_classify(x[i]), expected[i]);
+  }
+  ck_assert_uint_eq(mask, S21_FP_BIT(S21_FP_NAN) | S21_FP_BIT(S21_FP_INFINITE) |
+                              S21_FP_FINITE);
+  ck_assert_uint_eq(s21_classify_n(x + 7, NULL, 2),
+                    S21_FP_BIT(S21_FP_NORMAL) | S21_FP_NEGATIVE);
+  ck_assert_uint_eq(s21_classify_n(x + 8, NULL, 1), S21_FP_BIT(S21_FP_NORMAL));
+  ck_assert_uint_eq(s21_classify_n(x, NULL, 0), 0);
+}
+END_TEST
+
+START_TEST(test_count_nonfinite) {
+  double x[37];
+  for (int i = 0; i < 37; i++) x[i] = i - 18.5;
+  ck_assert_uint_eq(s21_count_nonfinite_n(x, 37), 0);
+  x[0] = NAN;
+  x[5] = INFINITY;
+  x[6] = -INFINITY;
+  x[36] = -NAN;
+  x[20] = S21_MAX;
+  x[21] = 4.9e-324;
+  ck_assert_uint_eq(s21_count_nonfinite_n(x, 37), 4);
+  ck_assert_uint_eq(s21_count_nonfinite_n(x + 1, 35), 2);
+}
+END_TEST
+
+START_TEST(test_sanitize_replace_and_clamp) {
+  s21_sanitize_opts opts = {S21_FP_BIT(S21_FP_NAN) |
+                                S21_FP_BIT(S21_FP_INFINITE) |
+                                S21_FP_BIT(S21_FP_SUBNORMAL),
+                            0.5, 100, -100, 0, -10, 10};
+  double x[8] = {NAN, INFINITY, -INFINITY, 1e-310, 3, -50, 50, -0.0};
+  double expected[8] = {0.5, 10, -10, 0, 3, -10, 10, -0.0};
+  ck_assert_uint_eq(s21_sanitize_n(x, x, 8, &opts), 6);
+  for (int i = 0; i < 8; i++) ck_assert_double_eq(x[i], expected[i]);
+  ck_assert(signbit(x[7]));
+  // без замены NaN остаётся, бесконечности прижимаются
+  s21_sanitize_opts keep = {0, 0, 0, 0, 0, -1, 1};
+  double y[3] = {NAN, INFINITY, 1e-310}, r[3];
+  ck_assert_uint_eq(s21_sanitize_n(y, r, 3, &keep), 1);
+  ck_assert_double_nan(r[0]);
+  ck_assert_double_eq(r[1], 1);
+  ck_assert_double_eq(r[2], 1e-310);
+}
+END_TEST
+
+START_TEST(test_sanitize_blocks_match_scalar) {
+  enum { N = 1003 };
+  static double x[N], r[N];
+  s21_sanitize_opts opts = {S21_FP_BIT(S21_FP_NAN) |
+                                S21_FP_BIT(S21_FP_SUBNORMAL),
+                            -1, 0, 0, 0, -S21_MAX, 1e6};
+  size_t changed = 0;
+  for (int i = 0; i < N; i++) {
+    x[i] = (i % 97 == 0) ? NAN : (i % 89 == 0) ? 1e-320 : (i - 500) * 4e3;
+    changed += (i % 97 == 0) || (i % 89 == 0 && i % 97 != 0) || x[i] > 1e6;
+  }
+  ck_assert_uint_eq(s21_sanitize_n(x, r, N, &opts), changed);
+  for (int i = 0; i < N; i++) {
+    double e = i % 97 == 0 ? -1 : i % 89 == 0 ? 0 : fmin(x[i], 1e6);
+    ck_assert_double_eq(r[i], e);
+  }
+}
+END_TEST
+
+START_TEST(test_async_results_match_sync) {
+  enum { N = 5000 };
+  static double x[N], y[N], r1[N], r2[N], r3[N], e[N];
+  for (int i = 0; i < N; i++) {
+    x[i] = 0.01 + i * 0.003;
+    y[i] = -2 + i * 0.001;
+  }
+  s21_async_config cfg = {2, 16, 0, 0};
+  s21_async_queue *q = s21_async_create(&cfg);
+  ck_assert_ptr_nonnull(q);
+  s21_async_job *a = s21_async_submit(q, S21_ASYNC_EXP, x, NULL, r1, N);
+  s21_async_job *b = s21_async_submit(q, S21_ASYNC_SQRT, x, NULL, r2, N);
+  s21_async_job *c = s21_async_submit(q, S21_ASYNC_POW, x, y, r3, 500);
+  ck_assert_ptr_nonnull(a);
+  ck_assert_ptr_nonnull(b);
+  ck_assert_ptr_nonnull(c);
+  ck_assert_ptr_null(s21_async_submit(q, S21_ASYNC_POW, x, NULL, r3, 1));
+  s21_async_wait(q, a);
+  ck_assert_int_eq(s21_async_poll(a), 1);
+  s21_exp_n(x, e, N);
+  ck_assert_mem_eq(r1, e, sizeof(e));
+  s21_async_release(q, b);
+  s21_sqrt_n(x, e, N);
+  ck_assert_mem_eq(r2, e, sizeof(e));
+  s21_async_release(q, c);
+  s21_pow_n(x, y, e, 500);
+  ck_assert_mem_eq(r3, e, 500 * sizeof(double));
+  s21_async_release(q, a);
+  s21_async_stats st;
+  s21_async_get_stats(q, &st);
+  ck_assert_uint_eq(st.submitted, 3);
+  ck_assert_uint_eq(st.completed, 3);
+  ck_assert_uint_eq(st.pending, 0);
+  ck_assert(st.latency >= st.service_time && st.max_service_time > 0);
+  s21_async_destroy(q);
+}
+END_TEST
+
+START_TEST(test_async_coalesces_small_jobs) {
+  enum { JOBS = 200, N = 16 };
+  static double x[N], res[JOBS][N];
+  s21_async_job *jobs[JOBS];
+  for (int i = 0; i < N; i++) x[i] = i * 0.25;
+  s21_async_config cfg = {1, 256, 0, 0};
+  s21_async_queue *q = s21_async_create(&cfg);
+  // пока очередь стоит, задания копятся; после запуска рабочий забирает их
+  // пачками по 64
+  s21_async_pause(q);
+  for (int j = 0; j < JOBS; j++) {
+    jobs[j] = s21_async_submit(q, S21_ASYNC_SIN, x, NULL, res[j], N);
+    ck_assert_ptr_nonnull(jobs[j]);
+  }
+  s21_async_stats st;
+  s21_async_get_stats(q, &st);
+  ck_assert_uint_eq(st.depth, JOBS);
+  ck_assert_uint_eq(st.max_depth, JOBS);
+  s21_async_resume(q);
+  for (int j = 0; j < JOBS; j++) s21_async_release(q, jobs[j]);
+  for (int j = 0; j < JOBS; j++) {
+    ck_assert_double_eq(res[j][N - 1], (double)s21_sin(x[N - 1]));
+  }
+  s21_async_get_stats(q, &st);
+  ck_assert_uint_eq(st.completed, JOBS);
+  ck_assert_uint_eq(st.batches, 4);
+  ck_assert_uint_eq(st.depth, 0);
+  s21_async_destroy(q);
+}
+END_TEST
+
+START_TEST(test_async_back_pressure) {
+  static double x[100], res[100];
+  s21_async_job *jobs[5];
+  s21_async_config cfg = {1, 4, 100, 0};
+  s21_async_queue *q = s21_async_create(&cfg);
+  s21_async_pause(q);
+  jobs[0] = s21_async_submit(q, S21_ASYNC_EXP, x, NULL, res, 60);
+  ck_assert_ptr_nonnull(jobs[0]);
+  // 60 + 60 > max_pending
+  ck_assert_ptr_null(s21_async_submit(q, S21_ASYNC_EXP, x, NULL, res, 60));
+  ck_assert_int_eq(errno, EAGAIN);
+  jobs[1] = s21_async_submit(q, S21_ASYNC_EXP, x + 60, NULL, res + 60, 40);
+  ck_assert_ptr_nonnull(jobs[1]);
+  // кольцо на 4 места
+  jobs[2] = s21_async_submit(q, S21_ASYNC_LOG, x, NULL, res, 0);
+  jobs[3] = s21_async_submit(q, S21_ASYNC_LOG, x, NULL, res, 0);
+  ck_assert_ptr_nonnull(jobs[3]);
+  ck_assert_ptr_null(s21_async_submit(q, S21_ASYNC_LOG, x, NULL, res, 0));
+  ck_assert_int_eq(errno, EAGAIN);
+  s21_async_stats st;
+  s21_async_get_stats(q, &st);
+  ck_assert_uint_eq(st.rejected, 2);
+  ck_assert_uint_eq(st.pending, 100);
+  s21_async_resume(q);
+  for (int j = 0; j < 4; j++) s21_async_release(q, jobs[j]);
+  jobs[4] = s21_async_submit(q, S21_ASYNC_EXP, x, NULL, res, 100);
+  ck_assert_ptr_nonnull(jobs[4]);
+  s21_async_release(q, jobs[4]);
+  s21_async_destroy(q);
+}
+END_TEST
+
+START_TEST(test_async_eventfd) {
+  double x[64], res[64];
+  for (int i = 0; i < 64; i++) x[i] = i;
+  s21_async_queue *q = s21_async_create(NULL);
+  int fd = s21_async_eventfd(q);
+#if defined(__linux__)
+  ck_assert_int_ge(fd, 0);
+#else
+  ck_assert_int_eq(fd, -1);
+#endif
+  s21_async_job *a = s21_async_submit(q, S21_ASYNC_LOG2, x, NULL, res, 64);
+  s21_async_job *b = s21_async_submit(q, S21_ASYNC_EXP2, x, NULL, res, 0);
+  s21_async_wait(q, a);
+  s21_async_wait(q, b);
+  if (fd >= 0) {
+    uint64_t count = 0;
+    ck_assert_int_eq(read(fd, &count, sizeof(count)), sizeof(count));
+    ck_assert_uint_eq(count, 2);
+  }
+  ck_assert_double_eq(res[8], 3);
+  s21_async_release(q, a);
+  s21_async_release(q, b);
+  s21_async_destroy(q);
+}
+END_TEST
+
+START_TEST(test_fp_mode_push_pop) {
+  volatile double tiny = S21_DBL_MIN;
+  ck_assert_int_eq(s21_fp_mode_get(), S21_FP_STRICT);
+  ck_assert_int_eq(s21_fp_mode_push(S21_FTZ_DAZ), 0);
+  ck_assert_int_eq(s21_fp_mode_get(), S21_FTZ_DAZ);
+#if defined(__SSE2__)
+  ck_assert_double_eq(tiny / 4, 0);
+#endif
+  ck_assert_int_eq(s21_fp_mode_push(S21_FP_STRICT), 0);
+  ck_assert_double_eq(tiny / 4, S21_DBL_MIN / 4);
+  s21_fp_mode_pop();
+  ck_assert_int_eq(s21_fp_mode_get(), S21_FTZ_DAZ);
+  s21_fp_mode_pop();
+  ck_assert_int_eq(s21_fp_mode_get(), S21_FP_STRICT);
+  ck_assert_double_eq(tiny / 4, S21_DBL_MIN / 4);
+  s21_fp_mode_pop();  // лишний pop ничего не меняет
+  ck_assert_int_eq(s21_fp_mode_get(), S21_FP_STRICT);
+  for (int i = 0; i < 16; i++) {
+    ck_assert_int_eq(s21_fp_mode_push(S21_FTZ_DAZ), 0);
+  }
+  ck_assert_int_eq(s21_fp_mode_push(S21_FP_STRICT), -1);
+  ck_assert_int_eq(s21_fp_mode_get(), S21_FTZ_DAZ);
+  for (int i = 0; i < 16; i++) s21_fp_mode_pop();
+  ck_assert_int_eq(s21_fp_mode_get(), S21_FP_STRICT);
+}
+END_TEST
+
+START_TEST(test_fp_mode_flushes_batch_exp) {
+  double x[4] = {-700, -720, -745, 0}, x2[3] = {-1000, -1030, 3};
+  double strict[4], ftz[4], strict2[3], ftz2[3];
+  s21_exp_n(x, strict, 4);
+  s21_exp2_n(x2, strict2, 3);
+  s21_fp_mode_push(S21_FTZ_DAZ);
+  s21_exp_n(x, ftz, 4);
+  s21_exp2_n(x2, ftz2, 3);
+  s21_fp_mode_pop();
+  ck_assert_double_eq_tol(strict[1], exp(-720), 1e-320);
+  ck_assert(strict[1] > 0 && strict[1] < S21_DBL_MIN);
+  ck_assert_double_eq(ftz[0], strict[0]);
+  ck_assert_double_eq(ftz[1], 0);
+  ck_assert_double_eq(ftz[2], 0);
+  ck_assert_double_eq(ftz[3], 1);
+  ck_assert(strict2[1] > 0);
+  ck_assert_double_eq(ftz2[0], strict2[0]);
+  ck_assert_double_eq(ftz2[1], 0);
+  ck_assert_double_eq(ftz2[2], 8);
+  double x10[3] = {-300, -310, 2}, strict10[3], ftz10[3];
+  s21_exp10_n(x10, strict10, 3);
+  s21_fp_mode_push(S21_FTZ_DAZ);
+  s21_exp10_n(x10, ftz10, 3);
+  s21_fp_mode_pop();
+  ck_assert(strict10[1] > 0 && strict10[1] < S21_DBL_MIN);
+  ck_assert_double_eq(ftz10[0], strict10[0]);
+  ck_assert_double_eq(ftz10[1], 0);
+  ck_assert_double_eq_tol(ftz10[2], 100, 1e-12);
+  // с DAZ денормализованный вход sqrt — ноль со своим знаком, а не сам вход
+  double xs[4] = {5e-324, -5e-324, 4, 0}, rs[4];
+  s21_fp_mode_push(S21_FTZ_DAZ);
+  s21_sqrt_n(xs, rs, 4);
+  long double scalar = s21_sqrt(1e-310);
+  s21_fp_mode_pop();
+  ck_assert_double_eq(rs[0], 0);
+  ck_assert(rs[1] == 0 && signbit(rs[1]));
+  ck_assert_double_eq(rs[2], 2);
+  ck_assert_double_eq(scalar, 0);
+  s21_sqrt_n(xs, rs, 4);
+  ck_assert_double_eq_tol(rs[0], sqrt(5e-324), 1e-176);
+  ck_assert_double_nan(rs[1]);
+}
+END_TEST
+
+START_TEST(test_fp_mode_follows_jobs) {
+  double x[2] = {-720, 1}, res[2];
+  s21_async_queue *q = s21_async_create(NULL);
+  s21_fp_mode_push(S21_FTZ_DAZ);
+  s21_async_job *job = s21_async_submit(q, S21_ASYNC_EXP, x, NULL, res, 2);
+  s21_fp_mode_pop();
+  s21_async_release(q, job);
+  ck_assert_double_eq(res[0], 0);
+  ck_assert_double_eq_tol(res[1], exp(1), 1e-15);
+  job = s21_async_submit(q, S21_ASYNC_EXP, x, NULL, res, 2);
+  s21_async_release(q, job);
+  ck_assert(res[0] > 0);
+  s21_async_destroy(q);
+  // куски s21_fsum в других потоках считаются в режиме вызывающего: с DAZ
+  // денормализованные слагаемые — нули во всех кусках
+  static double tiny[1 << 16];
+  for (int i = 0; i < 1 << 16; i++) tiny[i] = 1e-310;
+  s21_set_threads(4);
+  long double sum = s21_fsum(tiny, 1 << 16, S21_SUM_FAST);
+  s21_fp_mode_push(S21_FTZ_DAZ);
+  long double sum_ftz = s21_fsum(tiny, 1 << 16, S21_SUM_FAST);
+  s21_fp_mode_pop();
+  s21_set_threads(1);
+  ck_assert_double_eq_tol((double)sum, 65536e-310, 1e-315);
+#if defined(__SSE2__)
+  ck_assert_double_eq((double)sum_ftz, 0);
+#else
+  ck_assert_double_eq((double)sum_ftz, (double)sum);
+#endif
+}
+END_TEST
+
+START_TEST(test_subnormal_prescaled_kernels) {
+  double x[6] = {4.9e-324, 1e-310, 2.2e-308, 1e-300, 1e-200, 0.75};
+  double r[6];
+  for (int i = 0; i < 6; i++) {
+    ck_assert_double_eq_tol(s21_log(x[i]), log(x[i]), 1e-12);
+    ck_assert_double_eq_tol(s21_sqrt(x[i]) / sqrt(x[i]), 1, 1e-15);
+    ck_assert_double_eq_tol(s21_cbrt(x[i]) / cbrt(x[i]), 1, 1e-15);
+    ck_assert_double_eq_tol(s21_rsqrt_fast(x[i]) * sqrt(x[i]), 1, 1e-9);
+  }
+  s21_log_n(x, r, 6);
+  for (int i = 0; i < 6; i++) ck_assert_double_eq_tol(r[i], log(x[i]), 1e-12);
+  s21_sqrt_n(x, r, 6);
+  for (int i = 0; i < 6; i++) ck_assert_double_eq(r[i], sqrt(x[i]));
+  s21_rsqrt_n(x, r, 6);
+  for (int i = 0; i < 6; i++) {
+    ck_assert_double_eq_tol(r[i] * sqrt(x[i]), 1, 1e-15);
+  }
+}
+END_TEST
+
+START_TEST(test_sincos_ramp_matches_pointwise) {
+  enum { N = 10007 };
+  static double s[N], c[N];
+  double cases[6][2] = {{0.3, 1e-4}, {-5, 0.37}, {100, -2.5},
+                        {0, 0},     {1.2e9, 0.01}, {1e20, 0}};
+  for (int q = 0; q < 6; q++) {
+    double x0 = cases[q][0], dx = cases[q][1];
+    s21_sincos_ramp(x0, dx, s, c, N);
+    // точка x0 + k dx сложением углов: сумма не округляется при больших x0
+    for (int k = 0; k < N; k += 13) {
+      long double h = (long double)k * dx;
+      long double ws = sinl(x0) * cosl(h) + cosl(x0) * sinl(h);
+      long double wc = cosl(x0) * cosl(h) - sinl(x0) * sinl(h);
+      ck_assert_double_eq_tol(s[k], ws, 1e-14);
+      ck_assert_double_eq_tol(c[k], wc, 1e-14);
+    }
+    long double h = (long double)(N - 1) * dx;
+    ck_assert_double_eq_tol(s[N - 1], sinl(x0) * cosl(h) + cosl(x0) * sinl(h),
+                            1e-14);
+  }
+}
+END_TEST
+
+START_TEST(test_sincos_ramp_partial_and_null) {
+  double s[7], c[7];
+  for (int i = 0; i < 7; i++) s[i] = c[i] = -7;
+  s21_sincos_ramp(1, 0.5, s, NULL, 5);
+  for (int k = 0; k < 5; k++) {
+    ck_assert_double_eq_tol(s[k], sin(1 + k * 0.5), 1e-15);
+  }
+  ck_assert_double_eq(s[5], -7);
+  s21_sincos_ramp(1, 0.5, NULL, c, 3);
+  ck_assert_double_eq_tol(c[2], cos(2), 1e-15);
+  ck_assert_double_eq(c[3], -7);
+  s21_sincos_ramp(1, 0.5, s, c, 0);
+  ck_assert_double_eq(c[3], -7);
+  s21_sincos_ramp(S21_NAN, 0.5, s, c, 3);
+  ck_assert_double_nan(s[0]);
+  ck_assert_double_nan(c[2]);
+}
+END_TEST
+
+START_TEST(test_exp_ramp_matches_pointwise) {
+  enum { N = 5003 };
+  static double res[N];
+  double cases[3][2] = {{-1, 1e-3}, {-50, 0.02}, {30, -0.013}};
+  for (int q = 0; q < 3; q++) {
+    double a0 = cases[q][0], da = cases[q][1];
+    s21_exp_ramp(a0, da, res, N);
+    for (int k = 0; k < N; k += 7) {
+      long double r = expl(a0 + (long double)k * da);
+      ck_assert_double_eq_tol(res[k] / r, 1, 2e-15);
+    }
+  }
+}
+END_TEST
+
+START_TEST(test_exp_ramp_crosses_range) {
+  enum { N = 3000 };
+  static double res[N];
+  // от 705 до 735: переполнение посреди массива
+  s21_exp_ramp(705, 0.01, res, N);
+  ck_assert_double_eq_tol(res[100] / expl(705 + 100 * (long double)0.01), 1,
+                          2e-15);
+  ck_assert_double_eq_tol(res[409] / expl(705 + 409 * (long double)0.01), 1,
+                          2e-15);
+  ck_assert_double_infinite(res[500]);
+  ck_assert_double_infinite(res[N - 1]);
+  // от -700 вниз: денормализованные и ноль
+  s21_exp_ramp(-700, -0.02, res, N);
+  ck_assert_double_eq_tol(res[100] / expl(-700 - 100 * (long double)0.02), 1,
+                          2e-15);
+  ck_assert_double_eq_tol(res[1000], exp(-720), 1e-320);
+  ck_assert_double_eq(res[N - 1], 0);
+  s21_exp_ramp(0, S21_NAN, res, 3);
+  ck_assert_double_nan(res[1]);
+}
+END_TEST
+
+START_TEST(test_memo_hits_every_function) {
+  long double (*fns[S21_MEMO_COUNT])(double) = {
+      s21_acos, s21_asin, s21_exp, s21_lgamma, s21_log, NULL, s21_tgamma};
+  double x = 0.375;
+  for (int fn = 0; fn < S21_MEMO_COUNT; fn++) {
+    long double plain = fn == S21_MEMO_POW ? s21_pow(1.05, x) : fns[fn](x);
+    ck_assert_int_eq(s21_memo_enable((s21_memo_fn)fn, 100), 0);
+    for (int i = 0; i < 3; i++) {
+      long double r = fn == S21_MEMO_POW ? s21_pow(1.05, x) : fns[fn](x);
+      ck_assert_mem_eq(&r, &plain, 10);
+    }
+    s21_memo_stats st;
+    s21_memo_get_stats((s21_memo_fn)fn, &st);
+    ck_assert_uint_eq(st.size, 128);
+    ck_assert_uint_ge(st.hits, 2);
+    ck_assert_uint_ge(st.misses, 1);
+    s21_memo_disable((s21_memo_fn)fn);
+    s21_memo_get_stats((s21_memo_fn)fn, &st);
+    ck_assert_uint_eq(st.size, 0);
+    ck_assert_uint_eq(st.hits, 0);
+  }
+}
+END_TEST
+
+START_TEST(test_memo_rejects_bad_config) {
+  s21_memo_stats st;
+  ck_assert_int_eq(s21_memo_enable(S21_MEMO_COUNT, 0), -1);
+  ck_assert_int_eq(s21_memo_enable(S21_MEMO_LOG, (1u << 20) + 1), -1);
+  ck_assert_int_eq(s21_memo_enable(S21_MEMO_LOG, 0), 0);
+  s21_memo_get_stats(S21_MEMO_LOG, &st);
+  ck_assert_uint_eq(st.size, 256);
+  // NaN не кэшируется, особые значения до кэша не доходят
+  ck_assert_double_nan(s21_log(S21_NAN));
+  ck_assert_double_infinite(s21_log(0));
+  ck_assert_double_nan(s21_log(S21_NAN));
+  s21_memo_get_stats(S21_MEMO_LOG, &st);
+  ck_assert_uint_eq(st.hits + st.misses, 0);
+  s21_memo_disable(S21_MEMO_LOG);
+  s21_memo_disable(S21_MEMO_COUNT);
+  s21_memo_get_stats(S21_MEMO_COUNT, &st);
+  ck_assert_uint_eq(st.size, 0);
+}
+END_TEST
+
+START_TEST(test_memo_evicts_in_single_slot) {
+  s21_memo_stats st;
+  ck_assert_int_eq(s21_memo_enable(S21_MEMO_EXP, 1), 0);
+  ck_assert_double_eq_tol(s21_exp(1), exp(1), 1e-15);
+  ck_assert_double_eq_tol(s21_exp(2), exp(2), 1e-15);
+  ck_assert_double_eq_tol(s21_exp(1), exp(1), 1e-15);
+  ck_assert_double_eq_tol(s21_exp(1), exp(1), 1e-15);
+  s21_memo_get_stats(S21_MEMO_EXP, &st);
+  ck_assert_uint_eq(st.size, 1);
+  ck_assert_uint_eq(st.misses, 3);
+  ck_assert_uint_eq(st.hits, 1);
+  ck_assert_uint_eq(st.evictions, 2);
+  // повторное включение сбрасывает таблицу
+  ck_assert_int_eq(s21_memo_enable(S21_MEMO_EXP, 4), 0);
+  s21_memo_get_stats(S21_MEMO_EXP, &st);
+  ck_assert_uint_eq(st.misses + st.evictions, 0);
+  s21_memo_disable(S21_MEMO_EXP);
+}
+END_TEST
+
+static void *memo_thread(void *arg) {
+  s21_memo_stats *st = arg;
+  s21_pow(1.07, 2.5);
+  s21_memo_get_stats(S21_MEMO_POW, &st[0]);
+  s21_memo_enable(S21_MEMO_POW, 8);
+  s21_pow(1.07, 2.5);
+  s21_pow(1.07, 2.5);
+  s21_memo_get_stats(S21_MEMO_POW, &st[1]);
+  return NULL;  // таблица потока освобождается при его завершении
+}
+
+START_TEST(test_memo_is_per_thread) {
+  s21_memo_stats st[2], own;
+  pthread_t tid;
+  s21_memo_enable(S21_MEMO_POW, 16);
+  s21_pow(1.07, 2.5);
+  ck_assert_int_eq(pthread_create(&tid, NULL, memo_thread, st), 0);
+  pthread_join(tid, NULL);
+  s21_pow(1.07, 2.5);
+  s21_memo_get_stats(S21_MEMO_POW, &own);
+  ck_assert_uint_eq(st[0].size, 0);
+  ck_assert_uint_eq(st[0].misses, 0);
+  ck_assert_uint_eq(st[1].size, 8);
+  ck_assert_uint_eq(st[1].hits, 1);
+  ck_assert_uint_eq(own.size, 16);
+  ck_assert_uint_eq(own.hits, 1);
+  ck_assert_uint_eq(own.misses, 1);
+  s21_memo_disable(S21_MEMO_POW);
+}
+END_TEST
+
+START_TEST(test_rotate2d_in_place) {
+  double x[7] = {1, 0, -2, 3.5, 1e10, -0.25, 4};
+  double y[7] = {0, 1, 5, -1.5, 1, 8, -4};
+  double rx[7], ry[7];
+  s21_rotate2d_n(0.7, x, y, rx, ry, 7);
+  for (int i = 0; i < 7; i++) {
+    double tol = 1e-15 * (fabs(x[i]) + fabs(y[i]));
+    ck_assert_double_eq_tol(rx[i], cos(0.7) * x[i] - sin(0.7) * y[i], tol);
+    ck_assert_double_eq_tol(ry[i], sin(0.7) * x[i] + cos(0.7) * y[i], tol);
+  }
+  s21_rotate2d_n(0.7, rx, ry, rx, ry, 7);
+  s21_rotate2d_n(-1.4, rx, ry, rx, ry, 7);
+  for (int i = 0; i < 7; i++) {
+    double tol = 1e-15 * (fabs(x[i]) + fabs(y[i]));
+    ck_assert_double_eq_tol(rx[i], x[i], tol);
+    ck_assert_double_eq_tol(ry[i], y[i], tol);
+  }
+  s21_rotate2d_n(1e22, x, y, rx, ry, 1);
+  ck_assert_double_eq_tol(rx[0], cos(1e22), 1e-15);
+  ck_assert_double_eq_tol(ry[0], sin(1e22), 1e-15);
+}
+END_TEST
+
+START_TEST(test_polar_to_cart_matches_libm) {
+  enum { N = 1001 };
+  static double r[N], t[N], x[N], y[N];
+  for (int i = 0; i < N; i++) {
+    r[i] = 0.5 + i * 0.01;
+    t[i] = -50 + i * 0.0997;
+  }
+  t[10] = 1e6;
+  t[11] = 1e20;
+  t[500] = S21_NAN;
+  t[N - 1] = S21_INF;
+  s21_polar_to_cart_n(r, t, x, y, N);
+  for (int i = 0; i < N - 1; i++) {
+    if (i == 500) continue;
+    ck_assert_double_eq_tol(x[i], r[i] * cosl(t[i]), 1e-15 * r[i]);
+    ck_assert_double_eq_tol(y[i], r[i] * sinl(t[i]), 1e-15 * r[i]);
+  }
+  ck_assert_double_nan(x[500]);
+  ck_assert_double_nan(y[N - 1]);
+}
+END_TEST
+
+START_TEST(test_cart_to_polar_matches_atan2) {
+  enum { N = 2003 };
+  static double x[N], y[N], r[N], t[N];
+  for (int i = 0; i < N; i++) {
+    x[i] = 40 * sin(i * 0.37) - 3;
+    y[i] = 25 * cos(i * 1.13) + 1;
+  }
+  x[5] = 1e200;
+  y[6] = 1e-300, x[6] = 0;
+  s21_cart_to_polar_n(x, y, r, t, N);
+  for (int i = 0; i < N; i++) {
+    ck_assert_double_eq_tol(t[i], atan2(y[i], x[i]), 1e-15);
+    ck_assert_double_eq_tol(r[i], hypot(x[i], y[i]), 1e-15 * r[i]);
+  }
+  double sx[8] = {0, -0.0, 0, -0.0, -1, -1, S21_INF, -S21_INF};
+  double sy[8] = {0, 0, -0.0, -0.0, 0, -0.0, S21_INF, 2};
+  s21_cart_to_polar_n(sx, sy, r, t, 8);
+  for (int i = 0; i < 8; i++) {
+    double want = atan2(sy[i], sx[i]);
+    ck_assert_double_eq(t[i], want);
+    ck_assert_int_eq(signbit(t[i]) != 0, signbit(want) != 0);
+  }
+  ck_assert_double_infinite(r[6]);
+  ck_assert_double_eq(r[0], 0);
+  // один NaN в группе отправляет её в скалярный путь
+  double nx[8] = {1, NAN, 2, 3, -1, 0.5, 4, 1};
+  double ny[8] = {0.5, 0.5, 1, 1, 2, 2, NAN, 1};
+  s21_cart_to_polar_n(nx, ny, r, t, 8);
+  ck_assert_double_nan(t[1]);
+  ck_assert_double_nan(r[1]);
+  ck_assert_double_nan(t[6]);
+  ck_assert_double_eq_tol(t[0], atan2(0.5, 1), 1e-15);
+  ck_assert_double_eq_tol(t[7], atan2(1, 1), 1e-15);
+}
+END_TEST
+
+START_TEST(test_rotation_matrices) {
+  double m[9], k[9];
+  double id[4] = {2, 0, 0, 0}, zero[3] = {0, 0, 0};
+  s21_quat_to_matrix(id, m);
+  for (int i = 0; i < 9; i++) ck_assert_double_eq(m[i], i % 4 == 0);
+  s21_axis_angle_to_matrix(zero, 1.0, m);
+  for (int i = 0; i < 9; i++) ck_assert_double_eq(m[i], i % 4 == 0);
+  double z[3] = {0, 0, 5};
+  double want[9] = {0, -1, 0, 1, 0, 0, 0, 0, 1};
+  s21_axis_angle_to_matrix(z, S21_PI / 2, m);
+  for (int i = 0; i < 9; i++) ck_assert_double_eq_tol(m[i], want[i], 1e-15);
+  // тот же поворот ненормированным кватернионом
+  double q[4] = {3, 0, 0, 3};
+  s21_quat_to_matrix(q, k);
+  for (int i = 0; i < 9; i++) ck_assert_double_eq_tol(k[i], want[i], 1e-15);
+  double axis[3] = {1, -2, 0.5};
+  s21_axis_angle_to_matrix(axis, 0.9, m);
+  // ортогональность и ось неподвижна
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      double dot = 0;
+      for (int l = 0; l < 3; l++) dot += m[3 * i + l] * m[3 * j + l];
+      ck_assert_double_eq_tol(dot, i == j, 1e-15);
+    }
+    double v = m[3 * i] * axis[0] + m[3 * i + 1] * axis[1] +
+               m[3 * i + 2] * axis[2];
+    ck_assert_double_eq_tol(v, axis[i], 1e-15);
+  }
+}
+END_TEST
+
+// Test case for the s21math command-line tool (./s21math собирает цель test)
+static void cli_write(const char *path, const double *x, size_t n) {
+  FILE *f = fopen(path, "wb");
+  ck_assert_ptr_nonnull(f);
+  ck_assert_uint_eq(fwrite(x, sizeof(double), n, f), n);
+  fclose(f);
+}
+
+static size_t cli_read(const char *path, double *x, size_t n) {
+  FILE *f = fopen(path, "rb");
+  size_t got = f != NULL ? fread(x, sizeof(double), n, f) : 0;
+  if (f != NULL) fclose(f);
+  return got;
+}
+
+START_TEST(test_cli_mapped_round_trip) {
+  // вход — обычный файл, он и выход отображаются в память
+  size_t n = 100003;
+  double *x = malloc(n * sizeof(double));
+  double *out = malloc((n + 1) * sizeof(double));
+  for (size_t i = 0; i < n; i++) x[i] = 1 + (double)i / 64;
+  cli_write("cli_in.bin", x, n);
+  ck_assert_int_eq(
+      system("./s21math -q -t 2 -o cli_out.bin log,sqrt,pow:3 cli_in.bin"), 0);
+  ck_assert_uint_eq(cli_read("cli_out.bin", out, n + 1), n);
+  for (size_t i = 0; i < n; i++) {
+    double ref = pow(sqrt(log(x[i])), 3);
+    ck_assert_double_eq_tol(out[i], ref, 1e-14 * (1 + fabs(ref)));
+  }
+  remove("cli_in.bin");
+  remove("cli_out.bin");
+  free(x);
+  free(out);
+}
+END_TEST
+
+START_TEST(test_cli_stdin_stream) {
+  // из канала вход читается блоками с двойной буферизацией; размер больше
+  // блока, чтобы пройти и перенос между буферами
+  size_t n = (1 << 20) + 5;
+  double *x = malloc(n * sizeof(double));
+  double *out = malloc((n + 1) * sizeof(double));
+  for (size_t i = 0; i < n; i++) x[i] = (double)(i % 2001) / 200 - 5;
+  cli_write("cli_in.bin", x, n);
+  ck_assert_int_eq(system("cat cli_in.bin | ./s21math -q exp,fmod:7 - > "
+                          "cli_out.bin"),
+                   0);
+  ck_assert_uint_eq(cli_read("cli_out.bin", out, n + 1), n);
+  for (size_t i = 0; i < n; i++) {
+    ck_assert_double_eq_tol(out[i], fmod(exp(x[i]), 7), 1e-13);
+  }
+  remove("cli_in.bin");
+  remove("cli_out.bin");
+  free(x);
+  free(out);
+}
+END_TEST
+
+START_TEST(test_cli_appends_to_stdout) {
+  // stdout с O_APPEND пишется подряд, не обрезается и не отображается
+  double x[4] = {1, 4, 9, 16}, head[3] = {-1, -2, -3}, back[8];
+  cli_write("cli_in.bin", x, 4);
+  cli_write("cli_out.bin", head, 3);
+  ck_assert_int_eq(system("./s21math -q sqrt cli_in.bin >> cli_out.bin"), 0);
+  ck_assert_uint_eq(cli_read("cli_out.bin", back, 8), 7);
+  ck_assert_mem_eq(back, head, sizeof(head));
+  for (int i = 0; i < 4; i++) ck_assert_double_eq(back[3 + i], i + 1);
+  remove("cli_in.bin");
+  remove("cli_out.bin");
+}
+END_TEST
+
+START_TEST(test_cli_refuses_same_file) {
+  double x[4] = {1, 4, 9, 16}, back[5];
+  cli_write("cli_in.bin", x, 4);
+  ck_assert_int_ne(
+      system("./s21math -q -o cli_in.bin sqrt cli_in.bin 2>/dev/null"), 0);
+  ck_assert_int_ne(
+      system("./s21math -q sqrt -o cli_in.bin < cli_in.bin 2>/dev/null"), 0);
+  // вход не обрезан и не изменён
+  ck_assert_uint_eq(cli_read("cli_in.bin", back, 5), 4);
+  ck_assert_mem_eq(back, x, sizeof(x));
+  remove("cli_in.bin");
+}
+END_TEST
+
 Suite *abs_suite(void) {
   Suite *suite;
   TCase *tc_core;
@@ -605,6 +2575,7 @@ Suite *asin_suite(void) {
   tcase_add_test(tc_core, test_asin_out_of_range);
   tcase_add_test(tc_core, test_asin_below_range);
   tcase_add_test(tc_core, test_asin_special_cases);
+  tcase_add_test(tc_core, test_asin_acos_near_one);
 
   suite_add_tcase(suite, tc_core);
 
@@ -786,6 +2757,7 @@ Suite *sin_suite(void) {
   tcase_add_test(tc_core, test_sin_negative);
   tcase_add_test(tc_core, test_sin_zero);
   tcase_add_test(tc_core, test_sin_special_cases);
+  tcase_add_test(tc_core, test_sin_cos_large_arguments);
 
   suite_add_tcase(suite, tc_core);
 
@@ -803,6 +2775,8 @@ Suite *sqrt_suite(void) {
   tcase_add_test(tc_core, test_sqrt_zero);
   tcase_add_test(tc_core, test_sqrt_negative);
   tcase_add_test(tc_core, test_sqrt_special_cases);
+  tcase_add_test(tc_core, test_sqrt_large_and_subnormal);
+  tcase_add_test(tc_core, test_sqrt_batch);
 
   suite_add_tcase(suite, tc_core);
 
@@ -825,10 +2799,501 @@ Suite *tan_suite(void) {
   return suite;
 }
 
+Suite *cbrt_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("cbrt");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_cbrt_positive);
+  tcase_add_test(tc_core, test_cbrt_negative);
+  tcase_add_test(tc_core, test_cbrt_special_cases);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *exp2_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("exp2");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_exp2_values);
+  tcase_add_test(tc_core, test_exp2_special_cases);
+  tcase_add_test(tc_core, test_exp_log_family_batch);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *exp10_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("exp10");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_exp10_values);
+  tcase_add_test(tc_core, test_exp10_special_cases);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *expm1_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("expm1");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_expm1_small);
+  tcase_add_test(tc_core, test_expm1_values);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *log1p_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("log1p");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_log1p_small);
+  tcase_add_test(tc_core, test_log1p_values);
+  tcase_add_test(tc_core, test_log1p_special_cases);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *log2_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("log2");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_log2_values);
+  tcase_add_test(tc_core, test_log2_special_cases);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *log10_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("log10");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_log10_values);
+  tcase_add_test(tc_core, test_log10_special_cases);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *rsqrt_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("rsqrt");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_rsqrt_positive);
+  tcase_add_test(tc_core, test_rsqrt_fast_positive);
+  tcase_add_test(tc_core, test_rsqrt_special_cases);
+  tcase_add_test(tc_core, test_rsqrt_batch);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *fixed_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("fixed");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_sin_cos_q15);
+  tcase_add_test(tc_core, test_atan2_q15);
+  tcase_add_test(tc_core, test_exp_q16);
+  tcase_add_test(tc_core, test_sqrt_q16);
+  tcase_add_test(tc_core, test_fixed_batch);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *half_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("half");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_f16_conversion);
+  tcase_add_test(tc_core, test_bf16_conversion);
+  tcase_add_test(tc_core, test_f16_batch);
+  tcase_add_test(tc_core, test_bf16_batch);
+  tcase_add_test(tc_core, test_f16_batch_long);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *lut_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("lut");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_lut_linear_sin);
+  tcase_add_test(tc_core, test_lut_interp_orders);
+  tcase_add_test(tc_core, test_lut_clamp_and_batch);
+  tcase_add_test(tc_core, test_lut_invalid);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *strided_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("strided");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_strided_aos);
+  tcase_add_test(tc_core, test_strided_in_place);
+  tcase_add_test(tc_core, test_strided_negative);
+  tcase_add_test(tc_core, test_strided_binary);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *reduce_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("reduce");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_logsumexp_values);
+  tcase_add_test(tc_core, test_logsumexp_special_cases);
+  tcase_add_test(tc_core, test_sum_exp_values);
+  tcase_add_test(tc_core, test_softmax_values);
+  tcase_add_test(tc_core, test_reduce_threads_deterministic);
+  tcase_add_test(tc_core, test_reduce_pool_shared);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *sum_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("sum");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_fsum_compensated);
+  tcase_add_test(tc_core, test_dot_values);
+  tcase_add_test(tc_core, test_norm2_values);
+  tcase_add_test(tc_core, test_sum_threads_deterministic);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *special_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("special");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_erf_values);
+  tcase_add_test(tc_core, test_tgamma_values);
+  tcase_add_test(tc_core, test_lgamma_values);
+  tcase_add_test(tc_core, test_special_batch);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *random_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("random");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_philox_known_answer);
+  tcase_add_test(tc_core, test_randn_moments);
+  tcase_add_test(tc_core, test_rand_uniform_range);
+  tcase_add_test(tc_core, test_rand_streams_deterministic);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *tune_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("tune");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_tune_override);
+  tcase_add_test(tc_core, test_tune_budget);
+  tcase_add_test(tc_core, test_tune_special_values);
+  tcase_add_test(tc_core, test_tune_cache);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *cheb_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("cheb");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_cheb_tolerance);
+  tcase_add_test(tc_core, test_cheb_degree_and_segments);
+  tcase_add_test(tc_core, test_cheb_save_load);
+  tcase_add_test(tc_core, test_cheb_invalid);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *poly_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("poly");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_polyval_schemes);
+  tcase_add_test(tc_core, test_polyval_batch_matches_scalar);
+  tcase_add_test(tc_core, test_ratval_values);
+  tcase_add_test(tc_core, test_poly_kernels_accuracy);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *tgmath_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("tgmath");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_tgmath_selects_by_type);
+  tcase_add_test(tc_core, test_float_kernels_accuracy);
+  tcase_add_test(tc_core, test_float_kernels_special);
+  tcase_add_test(tc_core, test_long_double_kernels);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *complex_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("complex");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_cexp_clog_values);
+  tcase_add_test(tc_core, test_csqrt_cabs_carg);
+  tcase_add_test(tc_core, test_csin_ccos_cpow);
+  tcase_add_test(tc_core, test_complex_batch_matches_scalar);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *classify_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("classify");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_classify_values);
+  tcase_add_test(tc_core, test_count_nonfinite);
+  tcase_add_test(tc_core, test_sanitize_replace_and_clamp);
+  tcase_add_test(tc_core, test_sanitize_blocks_match_scalar);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *async_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("async");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_async_results_match_sync);
+  tcase_add_test(tc_core, test_async_coalesces_small_jobs);
+  tcase_add_test(tc_core, test_async_back_pressure);
+  tcase_add_test(tc_core, test_async_eventfd);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *fpmode_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("fpmode");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_fp_mode_push_pop);
+  tcase_add_test(tc_core, test_fp_mode_flushes_batch_exp);
+  tcase_add_test(tc_core, test_fp_mode_follows_jobs);
+  tcase_add_test(tc_core, test_subnormal_prescaled_kernels);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *ramp_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("ramp");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_sincos_ramp_matches_pointwise);
+  tcase_add_test(tc_core, test_sincos_ramp_partial_and_null);
+  tcase_add_test(tc_core, test_exp_ramp_matches_pointwise);
+  tcase_add_test(tc_core, test_exp_ramp_crosses_range);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *memo_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("memo");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_memo_hits_every_function);
+  tcase_add_test(tc_core, test_memo_rejects_bad_config);
+  tcase_add_test(tc_core, test_memo_evicts_in_single_slot);
+  tcase_add_test(tc_core, test_memo_is_per_thread);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *geom_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("geom");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_rotate2d_in_place);
+  tcase_add_test(tc_core, test_polar_to_cart_matches_libm);
+  tcase_add_test(tc_core, test_cart_to_polar_matches_atan2);
+  tcase_add_test(tc_core, test_rotation_matrices);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
+Suite *cli_suite(void) {
+  Suite *suite;
+  TCase *tc_core;
+
+  suite = suite_create("cli");
+  tc_core = tcase_create("core");
+
+  tcase_add_test(tc_core, test_cli_mapped_round_trip);
+  tcase_add_test(tc_core, test_cli_stdin_stream);
+  tcase_add_test(tc_core, test_cli_appends_to_stdout);
+  tcase_add_test(tc_core, test_cli_refuses_same_file);
+
+  suite_add_tcase(suite, tc_core);
+
+  return suite;
+}
+
 int main(void) {
   int number_failed;
   Suite *abs_s, *acos_s, *asin_s, *atan_s, *ceil_s, *cos_s, *exp_s, *fabs_s,
       *floor_s, *fmod_s, *log_s, *pow_s, *sin_s, *sqrt_s, *tan_s;
+  Suite *cbrt_s, *exp2_s, *exp10_s, *expm1_s, *log1p_s, *log2_s, *log10_s;
+  Suite *rsqrt_s;
+  Suite *fixed_s;
+  Suite *half_s;
+  Suite *lut_s;
+  Suite *strided_s;
+  Suite *reduce_s;
+  Suite *sum_s;
+  Suite *special_s;
+  Suite *random_s;
+  Suite *tune_s;
+  Suite *cheb_s;
+  Suite *poly_s;
+  Suite *tgmath_s;
+  Suite *complex_s;
+  Suite *classify_s;
+  Suite *async_s;
+  Suite *fpmode_s;
+  Suite *ramp_s;
+  Suite *memo_s;
+  Suite *geom_s;
+  Suite *cli_s;
   SRunner *sr;
 
   abs_s = abs_suite();
@@ -846,6 +3311,34 @@ int main(void) {
   sin_s = sin_suite();
   sqrt_s = sqrt_suite();
   tan_s = tan_suite();
+  cbrt_s = cbrt_suite();
+  exp2_s = exp2_suite();
+  exp10_s = exp10_suite();
+  expm1_s = expm1_suite();
+  log1p_s = log1p_suite();
+  log2_s = log2_suite();
+  log10_s = log10_suite();
+  rsqrt_s = rsqrt_suite();
+  fixed_s = fixed_suite();
+  half_s = half_suite();
+  lut_s = lut_suite();
+  strided_s = strided_suite();
+  reduce_s = reduce_suite();
+  sum_s = sum_suite();
+  special_s = special_suite();
+  random_s = random_suite();
+  tune_s = tune_suite();
+  cheb_s = cheb_suite();
+  poly_s = poly_suite();
+  tgmath_s = tgmath_suite();
+  complex_s = complex_suite();
+  classify_s = classify_suite();
+  async_s = async_suite();
+  fpmode_s = fpmode_suite();
+  ramp_s = ramp_suite();
+  memo_s = memo_suite();
+  geom_s = geom_suite();
+  cli_s = cli_suite();
 
   sr = srunner_create(abs_s);
   srunner_add_suite(sr, acos_s);
@@ -862,6 +3355,34 @@ int main(void) {
   srunner_add_suite(sr, sin_s);
   srunner_add_suite(sr, sqrt_s);
   srunner_add_suite(sr, tan_s);
+  srunner_add_suite(sr, cbrt_s);
+  srunner_add_suite(sr, exp2_s);
+  srunner_add_suite(sr, exp10_s);
+  srunner_add_suite(sr, expm1_s);
+  srunner_add_suite(sr, log1p_s);
+  srunner_add_suite(sr, log2_s);
+  srunner_add_suite(sr, log10_s);
+  srunner_add_suite(sr, rsqrt_s);
+  srunner_add_suite(sr, fixed_s);
+  srunner_add_suite(sr, half_s);
+  srunner_add_suite(sr, lut_s);
+  srunner_add_suite(sr, strided_s);
+  srunner_add_suite(sr, reduce_s);
+  srunner_add_suite(sr, sum_s);
+  srunner_add_suite(sr, special_s);
+  srunner_add_suite(sr, random_s);
+  srunner_add_suite(sr, tune_s);
+  srunner_add_suite(sr, cheb_s);
+  srunner_add_suite(sr, poly_s);
+  srunner_add_suite(sr, tgmath_s);
+  srunner_add_suite(sr, complex_s);
+  srunner_add_suite(sr, classify_s);
+  srunner_add_suite(sr, async_s);
+  srunner_add_suite(sr, fpmode_s);
+  srunner_add_suite(sr, ramp_s);
+  srunner_add_suite(sr, memo_s);
+  srunner_add_suite(sr, geom_s);
+  srunner_add_suite(sr, cli_s);
 
   srunner_run_all(sr, CK_NORMAL);
   number_failed = srunner_ntests_failed(sr);
@@ -2,13 +2,9 @@
 
 #include "s21_math.h"
 
-long int s21_factorial(int x) {
-  long int res = 1;
-  for (int i = 1; i <= x; i++) {
-    res *= i;
-  }
-  return res;
-}
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 long double s21_int_pow(double base, double exp) {
   long double res = 1.0;
@@ -50,4 +46,871 @@ int edge_pow(double base, double exp, long double *result) {
     *result = S21_NAN;
   }
   return edge;
-}
\ No newline at end of file
+}
+
+// Таблицы и полиномы для семейства exp/log. Все ядра выполняют фиксированное
+// число операций: редукция аргумента по таблице + многочлен постоянной
+// степени.
+
+#define S21_LN2_32_HI 0x1.62e42fefa4000p-6
+#define S21_LN2_32_LO -5.387326414254635866614e-15L
+#define S21_32_LN2 46.16624130844682903552L
+
+// 2^(j/32), j = 0..31
+static const long double s21_exp2_table[32] = {
+    1.000000000000000000000L, 1.021897148654116678234L,
+    1.044273782427413840322L, 1.067140400676823618170L,
+    1.090507732665257659207L, 1.114386742595892536309L,
+    1.138788634756691653704L, 1.163724858777577513814L,
+    1.189207115002721066717L, 1.215247359980468878117L,
+    1.241857812073484048594L, 1.269050957191733222554L,
+    1.296839554651009665934L, 1.325236643159741294630L,
+    1.354255546936892728298L, 1.383909881963831954873L,
+    1.414213562373095048802L, 1.445180806977046620037L,
+    1.476826145939499311387L, 1.509164427593422739766L,
+    1.542210825407940823612L, 1.575980845107886486455L,
+    1.610490331949254308180L, 1.645755478153964844519L,
+    1.681792830507429086062L, 1.718619298122477915629L,
+    1.756252160373299483112L, 1.794709075003107186428L,
+    1.834008086409342463487L, 1.874167634110299901330L,
+    1.915206561397147293873L, 1.957144124175400269018L};
+
+// ln(0.75 + j/32), j = 0..24
+static const long double s21_log_table[25] = {
+    -2.876820724517809274392e-1L, -2.468600779315257978846e-1L,
+    -2.076393647782445016154e-1L, -1.698990367953974729004e-1L,
+    -1.335313926245226231463e-1L, -9.844007281325251990289e-2L,
+    -6.453852113757117167292e-2L, -3.174869831458030115700e-2L,
+    0.0L,                         3.077165866675368837103e-2L,
+    6.062462181643484258061e-2L,  8.961215868968713261995e-2L,
+    1.177830356563834545388e-1L,  1.451820098444978972819e-1L,
+    1.718502569266592223401e-1L,  1.978257433299198803626e-1L,
+    2.231435513142097557663e-1L,  2.478361639045812567806e-1L,
+    2.719337154836417588317e-1L,  2.954642128938358763867e-1L,
+    3.184537311185346158102e-1L,  3.409265869705932103051e-1L,
+    3.629054936893684531378e-1L,  3.844116989103320397348e-1L,
+    4.054651081081643819780e-1L};
+
+// Тейлор для e^r, |r| <= ln2/64. Для e^r хватает степени 6, для
+// (e^r - 1) / r нужна степень 8
+static const long double s21_exp_coef[10] = {
+    1.0L,       1.0L,        1.0L / 2,     1.0L / 6,      1.0L / 24,
+    1.0L / 120, 1.0L / 720, 1.0L / 5040, 1.0L / 40320, 1.0L / 362880};
+
+// ln((1 + s) / (1 - s)) = 2s * P(s^2)
+static const long double s21_atanh_coef[5] = {1.0L, 1.0L / 3, 1.0L / 5,
+                                              1.0L / 7, 1.0L / 9};
+
+// Тейлор для sin и cos на |r| <= pi/4: sin r = r P(r^2), cos r = Q(r^2)
+static const long double s21_sin_coef[10] = {
+    1.0L,
+    -1.0L / 6,
+    1.0L / 120,
+    -1.0L / 5040,
+    1.0L / 362880,
+    -1.0L / 39916800,
+    1.0L / 6227020800.0L,
+    -1.0L / 1307674368000.0L,
+    1.0L / 355687428096000.0L,
+    -1.0L / 121645100408832000.0L};
+static const long double s21_cos_coef[11] = {
+    1.0L,
+    -1.0L / 2,
+    1.0L / 24,
+    -1.0L / 720,
+    1.0L / 40320,
+    -1.0L / 3628800,
+    1.0L / 479001600,
+    -1.0L / 87178291200.0L,
+    1.0L / 20922789888000.0L,
+    -1.0L / 6402373705728000.0L,
+    1.0L / 2432902008176640000.0L};
+
+// Тейлор для atan на |x| <= tan(pi/12): atan x = x P(x^2)
+static const long double s21_atan_coef[16] = {
+    1.0L,       -1.0L / 3,  1.0L / 5,   -1.0L / 7,  1.0L / 9,  -1.0L / 11,
+    1.0L / 13,  -1.0L / 15, 1.0L / 17,  -1.0L / 19, 1.0L / 21, -1.0L / 23,
+    1.0L / 25,  -1.0L / 27, 1.0L / 29,  -1.0L / 31};
+
+// C(2k, k) / (4^k (2k + 1)), k = 0..31: asin s = s P(s^2) на |s| <= 0.5
+static const long double s21_asin_coef[32] = {
+    1.000000000000000000000L, 1.666666666666666666667e-1L,
+    7.500000000000000000000e-2L, 4.464285714285714285714e-2L,
+    3.038194444444444444444e-2L, 2.237215909090909090909e-2L,
+    1.735276442307692307692e-2L, 1.396484375000000000000e-2L,
+    1.155180089613970588235e-2L, 9.761609529194078947368e-3L,
+    8.390335809616815476190e-3L, 7.312525873598845108696e-3L,
+    6.447210311889648437500e-3L, 5.740037670841923466435e-3L,
+    5.153309682319904195851e-3L, 4.660143486915096159904e-3L,
+    4.240907093679363077337e-3L, 3.880964558837669236319e-3L,
+    3.569205393825934545414e-3L, 3.297059503473484745392e-3L,
+    3.057821649258030669355e-3L, 2.846178401108942167877e-3L,
+    2.657870638207289933537e-3L, 2.489448678246883494641e-3L,
+    2.338091892111975186931e-3L, 2.201473973710138205420e-3L,
+    2.077661032518167442778e-3L, 1.965033616277283618439e-3L,
+    1.862226406403127489279e-3L, 1.768081120515418238652e-3L,
+    1.681609393583106800204e-3L, 1.601963275351444035730e-3L};
+
+// pi/2 тремя частями, в первых двух по 32 значащих бита: k * часть точно
+// при |k| < 2^32
+#define S21_PIO2_1 1.570796326734125614166259765625L
+#define S21_PIO2_2 6.077100506303965976595549136618501506745815277099609375e-11L
+#define S21_PIO2_3 2.0222662487959507323996846200947577e-21L
+#define S21_2_PI 0.636619772367581343075535053490057448L
+#define S21_TAN_PI_12 0.267949192431122706472553658494127633L
+#define S21_SQRT3 1.73205080756887729352744634150587237L
+
+uint64_t s21_double_bits(double x) {
+  union {
+    double d;
+    uint64_t u;
+  } bits = {.d = x};
+  return bits.u;
+}
+
+double s21_bits_double(uint64_t u) {
+  union {
+    uint64_t u;
+    double d;
+  } bits = {.u = u};
+  return bits.d;
+}
+
+long double s21_poly(const long double *coef, int degree, long double x) {
+  long double res = coef[degree];
+  for (int i = degree - 1; i >= 0; --i) {
+    res = res * x + coef[i];
+  }
+  return res;
+}
+
+// то же схемой Эстрина: пары коэффициентов считаются независимо, цепочка
+// зависимостей — log2(degree) шагов; degree <= 31
+long double s21_poly_estrin(const long double *coef, int degree,
+                            long double x) {
+  long double t[16];
+  int m = degree / 2 + 1;
+  for (int i = 0; i < m; i++) {
+    t[i] = 2 * i + 1 <= degree ? coef[2 * i] + coef[2 * i + 1] * x
+                               : coef[2 * i];
+  }
+  for (long double p = x * x; m > 1; p *= p) {
+    for (int i = 0; i < m / 2; i++) t[i] = t[2 * i] + t[2 * i + 1] * p;
+    if (m % 2) t[m / 2] = t[m - 1];
+    m = (m + 1) / 2;
+  }
+  return t[0];
+}
+
+// x = результат * 2^scale. Денормализованный x заменяется целым значением
+// своей мантиссы (scale = -1074): перевод целого в double точен и не
+// проходит через медленную обработку денормализованных чисел
+double s21_prescale(double x, int *scale) {
+  uint64_t bits = s21_double_bits(x);
+  double res = x;
+  *scale = 0;
+  if ((bits & 0x7ff0000000000000ULL) == 0 && (bits << 1) != 0) {
+    res = (double)(int64_t)(bits & 0x000fffffffffffffULL);
+    if (bits >> 63) res = -res;
+    *scale = -1074;
+  }
+  return res;
+}
+
+// x * 2^n, n ограничен [-2000, 2000] — этого хватает для всех ядер
+long double s21_scale2(long double x, int n) {
+  if (n > 2000) n = 2000;
+  if (n < -2000) n = -2000;
+  int half = n / 2;
+  double p1 = s21_bits_double((uint64_t)(half + 1023) << 52);
+  double p2 = s21_bits_double((uint64_t)(n - half + 1023) << 52);
+  return x * p1 * p2;
+}
+
+// e^r * 2^(k/32)
+static long double s21_exp_reduced(int k, long double r) {
+  int j = k % 32;
+  if (j < 0) j += 32;
+  return s21_scale2(s21_exp2_table[j] * s21_poly_estrin(s21_exp_coef, 6, r),
+                    (k - j) / 32);
+}
+
+long double s21_exp_kernel(long double x) {
+  long double res;
+  if (x != x) {
+    res = x;
+  } else if (x > 710) {
+    res = S21_INF;
+  } else if (x < -746) {
+    res = 0;
+  } else {
+    long double kf = x * S21_32_LN2;
+    int k = (int)(kf < 0 ? kf - 0.5L : kf + 0.5L);
+    long double r = (x - k * (long double)S21_LN2_32_HI) - k * S21_LN2_32_LO;
+    res = s21_exp_reduced(k, r);
+  }
+  return res;
+}
+
+long double s21_exp2_kernel(long double x) {
+  long double res;
+  if (x != x) {
+    res = x;
+  } else if (x > 1025) {
+    res = S21_INF;
+  } else if (x < -1077) {
+    res = 0;
+  } else {
+    long double kf = x * 32;
+    int k = (int)(kf < 0 ? kf - 0.5L : kf + 0.5L);
+    res = s21_exp_reduced(k, (x - k / 32.0L) * S21_LN2);
+  }
+  return res;
+}
+
+long double s21_expm1_kernel(long double x) {
+  long double res;
+  if (x > -S21_LN2_32_HI / 2 && x < S21_LN2_32_HI / 2) {
+    res = x * s21_poly(s21_exp_coef + 1, 8, x);
+  } else {
+    res = s21_exp_kernel(x) - 1;
+  }
+  return res;
+}
+
+// ln(x) = exponent * ln2 + возвращаемое значение, x > 0 и конечен
+long double s21_log_kernel(long double x, int *exponent) {
+  int e = 0;
+  if (x < S21_DBL_MIN) {
+    x = s21_scale2(x, 64);
+    e = -64;
+  }
+  int e0 = (int)((s21_double_bits((double)x) >> 52) & 0x7ff) - 1023;
+  long double m = s21_scale2(x, -e0);
+  e += e0;
+  if (m >= 1.5L) {
+    m *= 0.5L;
+    e++;
+  }
+  int j = (int)((m - 0.75L) * 32 + 0.5L);
+  if (j < 0) j = 0;
+  if (j > 24) j = 24;
+  long double c = 0.75L + j / 32.0L;
+  long double s = (m - c) / (m + c);
+  *exponent = e;
+  return s21_log_table[j] + 2 * s * s21_poly(s21_atanh_coef, 4, s * s);
+}
+
+// ln(1 + x), x > -1 и конечен
+long double s21_log1p_kernel(long double x) {
+  long double res;
+  if (x > -1.0L / 64 && x < 1.0L / 64) {
+    long double s = x / (2 + x);
+    res = 2 * s * s21_poly(s21_atanh_coef, 4, s * s);
+  } else {
+    int e;
+    long double m = s21_log_kernel(1 + x, &e);
+    res = e * S21_LN2 + m;
+  }
+  return res;
+}
+
+// x > 0 и конечен. На x86 — одна инструкция sqrtsd, иначе начальное
+// приближение делением показателя на 2 и четыре шага Ньютона.
+// Денормализованный x сначала масштабируется (scale чётный)
+double s21_sqrt_kernel(double x) {
+  int scale;
+  x = s21_prescale(x, &scale);
+#if defined(__SSE2__)
+  double y = _mm_cvtsd_f64(_mm_sqrt_sd(_mm_setzero_pd(), _mm_set_sd(x)));
+#else
+  long double y = s21_bits_double((s21_double_bits(x) >> 1) +
+                                  0x1ff8000000000000ULL);
+  for (int i = 0; i < 4; i++) {
+    y = (y + x / y) / 2;
+  }
+#endif
+  return scale ? (double)s21_scale2(y, scale / 2) : (double)y;
+}
+
+// 1/sqrt(x) для нормализованного x > 0: магическая константа и три шага
+// Ньютона без деления, относительная погрешность < 1e-10
+double s21_rsqrt_fast_kernel(double x) {
+  double y = s21_bits_double(0x5fe6eb50c7b537a9ULL -
+                             (s21_double_bits(x) >> 1));
+  double half = 0.5 * x;
+  for (int i = 0; i < 3; i++) {
+    y = y * (1.5 - half * y * y);
+  }
+  return y;
+}
+
+// n! для n = 0..25 — все значения точно представимы в long double
+static const long double s21_factorial_table[26] = {
+    1.0L,
+    1.0L,
+    2.0L,
+    6.0L,
+    24.0L,
+    120.0L,
+    720.0L,
+    5040.0L,
+    40320.0L,
+    362880.0L,
+    3628800.0L,
+    39916800.0L,
+    479001600.0L,
+    6227020800.0L,
+    87178291200.0L,
+    1307674368000.0L,
+    20922789888000.0L,
+    355687428096000.0L,
+    6402373705728000.0L,
+    121645100408832000.0L,
+    2432902008176640000.0L,
+    51090942171709440000.0L,
+    1124000727777607680000.0L,
+    25852016738884976640000.0L,
+    620448401733239439360000.0L,
+    15511210043330985984000000.0L};
+
+// ln Г(2 + z) = z P(z) на |z| <= 0.5: коэффициенты 1 - gamma и
+// (-1)^k (zeta(k) - 1) / k, k = 2..34; без свободного члена, поэтому
+// корни x = 1 и x = 2 не теряют относительную точность
+static const long double s21_lgamma2_coef[34] = {
+    4.227843350984671393935e-1L, 3.224670334241132182362e-1L,
+    -6.735230105319809513325e-2L, 2.058080842778454787900e-2L,
+    -7.385551028673985266273e-3L, 2.890510330741523285753e-3L,
+    -1.192753911703260977114e-3L, 5.096695247430424223357e-4L,
+    -2.231547584535793797614e-4L, 9.945751278180853371460e-5L,
+    -4.492623673813314170021e-5L, 2.050721277567069155317e-5L,
+    -9.439488275268395903987e-6L, 4.374866789907487804182e-6L,
+    -2.039215753801366236782e-6L, 9.551412130407419832857e-7L,
+    -4.492469198764566043294e-7L, 2.120718480555466586923e-7L,
+    -1.004322482396809960872e-7L, 4.769810169363980565760e-8L,
+    -2.271109460894316491032e-8L, 1.083865921489695409107e-8L,
+    -5.183475041970046655121e-9L, 2.483674543802478317185e-9L,
+    -1.192140140586091207443e-9L, 5.731367241678862013330e-10L,
+    -2.759522885124233145178e-10L, 1.330476437424448948150e-10L,
+    -6.422964563838100022082e-11L, 3.104424774732227276239e-11L,
+    -1.502138408075414217093e-11L, 7.275974480239079662505e-12L,
+    -3.527742476575915083615e-12L, 1.711991790559617908601e-12L};
+
+// B_2k / (2k (2k - 1)), k = 1..10 — ряд Стирлинга по 1/x^2; при x >= 13
+// отброшенный остаток меньше 1e-21
+static const long double s21_stirling_coef[10] = {
+    1.0L / 12,         -1.0L / 360,       1.0L / 1260,        -1.0L / 1680,
+    1.0L / 1188,       -691.0L / 360360,  1.0L / 156,         -3617.0L / 122400,
+    43867.0L / 244188, -174611.0L / 125400};
+
+#define S21_GAMMA_STIRLING 13
+
+// (-1)^k pi^(2k+1) / (2k+1)!: sin(pi * y) = y * P(y^2)
+static const long double s21_sinpi_coef[12] = {
+    3.14159265358979323846264338328L,    -5.16771278004997002924605251118L,
+    2.55016403987734544385617758370L,    -0.599264529320792076887739383546L,
+    0.0821458866111282287988023655236L,  -0.00737043094571435077725908995700L,
+    0.000466302805767612564420628914L,   -0.0000219153534478302158273846520L,
+    7.95205400147551278478320686246e-7L, -2.29484289972698731102038723856e-8L,
+    5.39266466260812848935231228566e-10L,
+    -1.05184717169320644551330616082e-11L};
+
+#define S21_LN_SQRT_2PI 0.918938533204672741780329736406L
+#define S21_2_SQRT_PI 1.12837916709551257389615890312L
+#define S21_SQRT_PI 1.77245385090551602729816748334L
+
+static long double s21_ln(long double x) {
+  int e;
+  long double m = s21_log_kernel(x, &e);
+  return e * S21_LN2 + m;
+}
+
+// целое ли x; все double с |x| >= 2^52 целые
+static int s21_is_integer(long double x) {
+  return s21_fabs(x) >= 4503599627370496.0 || x == (long double)(int64_t)x;
+}
+
+// sin(pi * x) для конечного x: приведение по модулю 2 точное, поэтому
+// нули в целых точках не теряются
+long double s21_sinpi_kernel(long double x) {
+  int neg = x < 0;
+  long double res = 0;
+  if (neg) x = -x;
+  if (x < 4503599627370496.0) {
+    x -= 2 * (long double)(int64_t)(x / 2);
+    if (x >= 1) {
+      x -= 1;
+      neg = !neg;
+    }
+    if (x > 0.5L) x = 1 - x;
+    res = x * s21_poly(s21_sinpi_coef, 11, x * x);
+  }
+  return neg ? -res : res;
+}
+
+// ln Г(x) для x >= S21_GAMMA_STIRLING
+static long double s21_lgamma_stirling(long double x) {
+  long double z = 1 / (x * x);
+  return (x - 0.5L) * s21_ln(x) - x + S21_LN_SQRT_2PI +
+         s21_poly(s21_stirling_coef, 9, z) / x;
+}
+
+// a * b = hi + lo точно (Деккер): множители делятся на половины по 32 бита
+static void s21_two_prod(long double a, long double b, long double *hi,
+                         long double *lo) {
+  const long double split = 4294967297.0L;  // 2^32 + 1
+  long double ta = a * split, tb = b * split;
+  long double ah = ta - (ta - a), bh = tb - (tb - b);
+  long double al = a - ah, bl = b - bh;
+  *hi = a * b;
+  *lo = ((ah * bh - *hi) + ah * bl + al * bh) + al * bl;
+}
+
+// |x| < S21_GAMMA_STIRLING, x не полюс: сдвиг на целое до y в [1.5, 2.5),
+// Г(x) = Г(y) * p при x >= 2.5 и Г(y) / p при x < 1.5 (*down = 1).
+// Возвращает ln Г(y). Сдвиги точны, а p = p[0] + p[1] считается без
+// округлений: у корней ln Г слагаемые ln Г(y) и ln|p| почти равны
+static long double s21_lgamma_shift(long double x, long double p[2],
+                                    int *down) {
+  long double y = x, lo;
+  p[0] = 1;
+  p[1] = 0;
+  *down = x < 1.5L;
+  while (y >= 2.5L || y < 1.5L) {
+    if (y >= 2.5L) y -= 1;
+    s21_two_prod(p[0], y, &p[0], &lo);
+    p[1] = p[1] * y + lo;
+    if (y < 1.5L) y += 1;
+  }
+  long double z = y - 2;
+  return z * s21_poly(s21_lgamma2_coef, 33, z);
+}
+
+// ln|p| для p != 0; около 1 — через log1p, чтобы не терять точность у
+// корней ln Г
+static long double s21_ln_abs(long double p) {
+  if (p < 0) p = -p;
+  return p >= 0.5L && p < 2 ? s21_log1p_kernel(p - 1) : s21_ln(p);
+}
+
+// ln|Г(x)| и знак Г(x) для конечного x, не являющегося полюсом (0, -1, ...).
+// x <= -S21_GAMMA_STIRLING — через отражение Г(x) Г(1 - x) = pi / sin(pi x)
+long double s21_lgamma_kernel(long double x, int *sign) {
+  long double res;
+  *sign = 1;
+  if (x >= 1 && x <= 26 && s21_is_integer(x)) {
+    res = s21_ln(s21_factorial_table[(int)x - 1]);
+  } else if (x >= S21_GAMMA_STIRLING) {
+    res = s21_lgamma_stirling(x);
+  } else if (x > -S21_GAMMA_STIRLING) {
+    long double p[2];
+    int down;
+    res = s21_lgamma_shift(x, p, &down);
+    long double ln_p = s21_ln_abs(p[0]) + p[1] / p[0];
+    res += down ? -ln_p : ln_p;
+    if (p[0] < 0) *sign = -1;
+  } else {
+    long double s = s21_sinpi_kernel(x);
+    if (s < 0) *sign = -1;
+    res = s21_ln(S21_PI_L) - s21_ln_abs(s) - s21_lgamma_stirling(1 - x);
+  }
+  return res;
+}
+
+// Г(x) для конечного x, не являющегося полюсом
+long double s21_tgamma_kernel(long double x) {
+  long double res;
+  if (x >= 1 && x <= 26 && s21_is_integer(x)) {
+    res = s21_factorial_table[(int)x - 1];
+  } else if (x >= S21_GAMMA_STIRLING) {
+    res = s21_exp_kernel(s21_lgamma_stirling(x));
+  } else if (x > -S21_GAMMA_STIRLING) {
+    long double p[2];
+    int down;
+    res = s21_exp_kernel(s21_lgamma_shift(x, p, &down));
+    res = down ? res / (p[0] + p[1]) : res * (p[0] + p[1]);
+  } else {
+    // через ln|Г|: сам Г(1 - x) переполняется, а e^(-ln Г(1 - x))
+    // уходит в ноль раньше результата
+    int sign;
+    res = s21_exp_kernel(s21_lgamma_kernel(x, &sign));
+    if (sign < 0) res = -res;
+  }
+  return res;
+}
+
+// erf(x) для |x| < 2.5: ряд Тейлора с фиксированным числом членов
+long double s21_erf_kernel(long double x) {
+  long double x2 = x * x;
+  long double term = x;
+  long double sum = x;
+  for (int n = 1; n <= 48; n++) {
+    term *= -x2 / n;
+    sum += term / (2 * n + 1);
+  }
+  return S21_2_SQRT_PI * sum;
+}
+
+// erfc(c) и 2/sqrt(pi) e^(-c^2) в узлах c = j/8, j = 4..20
+static const long double s21_erfc_nodes[17][2] = {
+    {4.795001221869534623173e-1L, 8.787825789354447940937e-1L},
+    {3.767591178115820275514e-1L, 7.634995357606048850875e-1L},
+    {2.888443663464848684011e-1L, 6.429310691952073290535e-1L},
+    {2.159249389401403416855e-1L, 5.247450452901482187038e-1L},
+    {1.572992070502851306588e-1L, 4.151074974205947033403e-1L},
+    {1.116117682982922359304e-1L, 3.182739585007693034424e-1L},
+    {7.709987174354176986348e-2L, 2.365211224472907872200e-1L},
+    {5.182992721790967743607e-2L, 1.703597736875155951899e-1L},
+    {3.389485352468927293302e-2L, 1.189302892236293715310e-1L},
+    {2.155626676001633527982e-2L, 8.047225902251116495326e-2L},
+    {1.332832878081755622779e-2L, 5.277499593015037466289e-2L},
+    {8.009942329880029703537e-3L, 3.354582842421607459425e-2L},
+    {4.677734981047265837931e-3L, 2.066698535409205385707e-2L},
+    {2.654029359482341530673e-3L, 1.234082061433369508984e-2L},
+    {1.462716586681151697911e-3L, 7.142319022017983039286e-3L},
+    {7.829382178911191975511e-4L, 4.006477861670219404763e-3L},
+    {4.069520174449589395642e-4L, 2.178284230352709720387e-3L}};
+
+#define S21_ERFC_TERMS 18
+
+// erfc(x) для 0.5 <= x < 2.5 рядом Тейлора в ближайшем узле c, |h| <= 1/16:
+// erfc^(n+1)(c) = (-1)^(n+1) 2/sqrt(pi) H_n(c) e^(-c^2), H_n — многочлены
+// Эрмита. Значение в узле берётся из таблицы, поэтому вычитания 1 - erf нет
+static long double s21_erfc_mid(long double x) {
+  int j = (int)(x * 8 + 0.5L);
+  long double c = j / 8.0L, h = x - c;
+  long double hn = 1, hn1 = 2 * c, t = h, sum = h;
+  for (int n = 1; n < S21_ERFC_TERMS; n++) {
+    t *= -h / (n + 1);
+    sum += hn1 * t;
+    long double next = 2 * c * hn1 - 2 * n * hn;
+    hn = hn1;
+    hn1 = next;
+  }
+  return s21_erfc_nodes[j - 4][0] - s21_erfc_nodes[j - 4][1] * sum;
+}
+
+// erfc(x) для x >= 0.5: до 2.5 — ряд в узлах, дальше цепная дробь Лапласа
+// фиксированной глубины, то есть рациональная функция от x на e^(-x^2)
+long double s21_erfc_kernel(long double x) {
+  long double res = 0;
+  if (x < 2.5L) {
+    res = s21_erfc_mid(x);
+  } else if (x < 27.3L) {
+    long double t = x;
+    for (int k = 40; k > 0; k--) t = x + k / (2 * t);
+    res = s21_exp_kernel(-x * x) / (S21_SQRT_PI * t);
+  }
+  return res;
+}
+
+// Приведение Пэйна — Хэнека для |x| >= 2^31. x = m * 2^s, m < 2^96 целое,
+// s кратно 32; x * 2/pi по модулю 4 — произведение m на окно из
+// S21_PH_WORDS слов 2/pi: слова левее окна дают слагаемые, кратные 4, а
+// отброшенный хвост — погрешность меньше 2^-190. Умножение целочисленное,
+// поэтому остаток не теряет точность даже для x около LDBL_MAX
+#define S21_PH_WORDS 10
+#define S21_PH_LIMBS (S21_PH_WORDS + 3)
+
+// 2/pi по 32 бита после запятой, слово i — биты 32i + 1 .. 32i + 32
+static const uint32_t s21_2_pi_bits[530] = {
+    0xa2f9836e, 0x4e441529, 0xfc2757d1, 0xf534ddc0, 0xdb629599, 0x3c439041,
+    0xfe5163ab, 0xdebbc561, 0xb7246e3a, 0x424dd2e0, 0x06492eea, 0x09d1921c,
+    0xfe1deb1c, 0xb129a73e, 0xe88235f5, 0x2ebb4484, 0xe99c7026, 0xb45f7e41,
+    0x3991d639, 0x835339f4, 0x9c845f8b, 0xbdf9283b, 0x1ff897ff, 0xde05980f,
+    0xef2f118b, 0x5a0a6d1f, 0x6d367ecf, 0x27cb09b7, 0x4f463f66, 0x9e5fea2d,
+    0x7527bac7, 0xebe5f17b, 0x3d0739f7, 0x8a5292ea, 0x6bfb5fb1, 0x1f8d5d08,
+    0x56033046, 0xfc7b6bab, 0xf0cfbc20, 0x9af4361d, 0xa9e39161, 0x5ee61b08,
+    0x6599855f, 0x14a06840, 0x8dffd880, 0x4d732731, 0x06061556, 0xca73a8c9,
+    0x60e27bc0, 0x8c6b47c4, 0x19c367cd, 0xdce8092a, 0x8359c476, 0x8b961ca6,
+    0xddaf44d1, 0x5719053e, 0xa5ff0705, 0x3f7e33e8, 0x32c2de4f, 0x98327dbb,
+    0xc33d26ef, 0x6b1e5ef8, 0x9f3a1f35, 0xcaf27f1d, 0x87f12190, 0x7c7c246a,
+    0xfa6ed577, 0x2d30433b, 0x15c614b5, 0x9d19c3c2, 0xc4ad414d, 0x2c5d000c,
+    0x467d862d, 0x71e39ac6, 0x9b006233, 0x7cd2b497, 0xa7b4d555, 0x37f63ed7,
+    0x1810a3fc, 0x764d2a9d, 0x64abd770, 0xf87c6357, 0xb07ae715, 0x175649c0,
+    0xd9d63b38, 0x84a7cb23, 0x24778ad6, 0x23545ab9, 0x1f001b0a, 0xf1dfce19,
+    0xff319f6a, 0x1e666157, 0x9947fbac, 0xd87f7eb7, 0x652289e8, 0x3260bfe6,
+    0xcdc4ef09, 0x366cd43f, 0x5dd7de16, 0xde3b5892, 0x9bde2822, 0xd2e88628,
+    0x4d58e232, 0xcac616e3, 0x08cb7de0, 0x50c017a7, 0x1df35be0, 0x1834132e,
+    0x62128301, 0x48835b8e, 0xf57fb0ad, 0xf2e91e43, 0x4a48d367, 0x10d8ddaa,
+    0x425faece, 0x616aa428, 0x0ab499d3, 0xf2a6067f, 0x775c83c2, 0xa3883c61,
+    0x78738a5a, 0x8cafbdd7, 0x6f63a62d, 0xcbbff4ef, 0x818d67c1, 0x2645ca55,
+    0x36d9cad2, 0xa8288d61, 0xc277c912, 0x1426049b, 0x4612c459, 0xc444c5c8,
+    0x91b24df3, 0x1700ad43, 0xd4e54929, 0x10d5fdfc, 0xbe00cc94, 0x1eeece70,
+    0xf53e1380, 0xf1ecc3e7, 0xb328f8c7, 0x9405933e, 0x71c1b309, 0x2ef3450b,
+    0x9c12887b, 0x20ab9fb5, 0x2ec29247, 0x2f327b6d, 0x550c90a7, 0x721fe76b,
+    0x96cb314a, 0x1679e279, 0x4189dff4, 0x9794e884, 0xe6e29731, 0x996bed88,
+    0x365f5f0e, 0xfdbbb49a, 0x486ca467, 0x42727132, 0x5d8db815, 0x9f09e5bc,
+    0x25318d39, 0x74f71c05, 0x30010c0d, 0x68084b58, 0xee2c90aa, 0x4702e774,
+    0x24d6bda6, 0x7df77248, 0x6eef169f, 0xa6948ef6, 0x91b45153, 0xd1f20acf,
+    0x3398207e, 0x4bf56863, 0xb25f3edd, 0x035d407f, 0x89852952, 0x55c06437,
+    0x10d86d32, 0x4832754c, 0x5bd4714e, 0x6e5445c1, 0x090b69f5, 0x2ad56614,
+    0x9d072750, 0x045ddb3b, 0xb4c576ea, 0x17f9877d, 0x6b49ba27, 0x1d296996,
+    0xacccc654, 0x14ad6ae2, 0x9089d988, 0x50722cbe, 0xa4049407, 0x777030f3,
+    0x27fc00a8, 0x71ea49c2, 0x663de064, 0x83dd9797, 0x3fa3fd94, 0x438c860d,
+    0xde41319d, 0x39928c70, 0xdde7b717, 0x3bdf082b, 0x3715a080, 0x5c93805a,
+    0x921110d8, 0xe80faf80, 0x6c4bffdb, 0x0f903876, 0x185915a5, 0x62bbcb61,
+    0xb989c7bd, 0x401004f2, 0xd2277549, 0xf6b6ebbb, 0x22dbaa14, 0x0a2f2689,
+    0x76836433, 0x3b091a94, 0x0eaa3a51, 0xc2a31dae, 0xedaf1226, 0x5c4dc26d,
+    0x9c7a2d97, 0x56c0833f, 0x03f6f009, 0x8c402b99, 0x316d07b4, 0x3915200c,
+    0x5bc3d8c4, 0x92f54bad, 0xc6a5ca4e, 0xcd37a736, 0xa9e69492, 0xab6842dd,
+    0xde6319ef, 0x8c76528b, 0x6837dbfc, 0xaba1ae31, 0x15dfa1ae, 0x00dafb0c,
+    0x664d64b7, 0x05ed3065, 0x29bf5657, 0x3aff47b9, 0xf96af3be, 0x75df9328,
+    0x3080abf6, 0x8c6615cb, 0x040622fa, 0x1de4d9a4, 0xb33d8f1b, 0x5709cd36,
+    0xe9424ea4, 0xbe13b523, 0x331aaaf0, 0xa8654fa5, 0xc1d20f3f, 0x0bcd785b,
+    0x76f92304, 0x8b7b7217, 0x8953a6c6, 0xe26e6f00, 0xebef584a, 0x9bb7dac4,
+    0xba66aacf, 0xcf761d02, 0xd12df1b1, 0xc1998c77, 0xadc3da48, 0x86a05df7,
+    0xf480c62f, 0xf0ac9aec, 0xddbc5c3f, 0x6dded01f, 0xc790b6db, 0x2a3a25a3,
+    0x9aaf0093, 0x53ad0457, 0xb6b42d29, 0x7e804ba7, 0x07da0eaa, 0x76a1597b,
+    0x2a12162d, 0xb7dcfde5, 0xfafedb89, 0xfdbe896c, 0x76e4fca9, 0x0670803e,
+    0x156e85ff, 0x87fd073e, 0x28336761, 0x86182aea, 0xbd4dafe7, 0xb36e6d8f,
+    0x3967955b, 0xbf3148d7, 0x8416df30, 0x432dc735, 0x6125ce70, 0xc9b8cb30,
+    0xfd6cbfa2, 0x00a4e46c, 0x05a0dd5a, 0x476f21d2, 0x1262845c, 0xb9496170,
+    0xe0566b01, 0x52993755, 0x50b7d51e, 0xc4f1335f, 0x6e13e430, 0x5da92e85,
+    0xc3b21d36, 0x32a1a4b7, 0x08d4b1ea, 0x21f716e4, 0x698f77ff, 0x2780030c,
+    0x2d408da0, 0xcd4f99a5, 0x20d3a2b3, 0x0a5d2f42, 0xf9b4cbda, 0x11d0be7d,
+    0xc1db9bbd, 0x17ab81a2, 0xca5c6a08, 0x17552e55, 0x0027f014, 0x7f8607e1,
+    0x640b148d, 0x4196debe, 0x872afdda, 0xb6256b34, 0x897bfef3, 0x059ebfb9,
+    0x4f6a68a8, 0x2a4a5ac4, 0x4fbcf82d, 0x985ad795, 0xc7f48d4d, 0x0da63a20,
+    0x5f57a4b1, 0x3f149538, 0x800120cc, 0x86dd71b6, 0xdec9f560, 0xbf11654d,
+    0x6b0701ac, 0xb08cd0c0, 0xb2485551, 0x0efb1ec3, 0x72953b06, 0xa33540c0,
+    0x7bdc06cc, 0x45e0fa29, 0x4ec8cad6, 0x41f3e8de, 0x647cd864, 0x9b31bed9,
+    0xc397a4d4, 0x5877c5e3, 0x6913daf0, 0x3c3aba46, 0x18465f75, 0x55f5bdd2,
+    0xc6926e5d, 0x2eaced44, 0x0e423e1c, 0x87c461e9, 0xfd29f3d6, 0xe7ca7c22,
+    0x35916fc5, 0xe0088dd7, 0xffe26a6e, 0xc6fdb0c1, 0x0893745d, 0x7cb2ad6b,
+    0x9d6ecd7b, 0x723e6a11, 0xc6a9cff7, 0xdf7329ba, 0xc9b55100, 0xb70db2e2,
+    0x24ba7460, 0x7de58ad8, 0x742c150d, 0x0c188194, 0x667e1629, 0x01767a9f,
+    0xbefdfdef, 0x4556367e, 0xd913d9ec, 0xb9ba8bfc, 0x97c427a8, 0x31c36ef1,
+    0x36c59456, 0xa8d8b5a8, 0xb40ecccf, 0x2d891234, 0x576f8956, 0x2ce3ce99,
+    0xb920d6aa, 0x5e6b9c2a, 0x3ecc5f11, 0x4a0bfdfb, 0xf4e16d3b, 0x8e2c86e2,
+    0x84d4e9a9, 0xb4fcd1ee, 0xefc9352e, 0x61392f44, 0x2138c8d9, 0x1b0afc81,
+    0x6a4afbd8, 0x1c2f84b4, 0x538c994e, 0xcc2254dc, 0x552ad6c6, 0xc096190b,
+    0xb8701a64, 0x9569605a, 0x26ee523f, 0x0f117f11, 0xb5f4f5cb, 0xfc2dbc34,
+    0xeebc34cc, 0x5de8605e, 0xdd9b8e67, 0xef3392b8, 0x17c99b58, 0x61bc57e1,
+    0xc6835110, 0x3ed84871, 0xdddd1c2d, 0xa118af46, 0x2c21d7f3, 0x59987ad9,
+    0xc0549efa, 0x864ffc06, 0x56ae79e5, 0x36228922, 0xad38dc93, 0x67aae855,
+    0x3826829b, 0xe7caa40d, 0x51b13399, 0x0ed7a948, 0x0569f0b2, 0x65a7887f,
+    0x974c8836, 0xd1f9b392, 0x214a827b, 0x21cf98dc, 0x9f405547, 0xdc3a74e1,
+    0x42eb67df, 0x9dfe5fd4, 0x5ea4677b, 0x7aacbaa2, 0xf6552388, 0x2b55ba41,
+    0x086e5986, 0x2a218347, 0x39e6e389, 0xd49ee540, 0xfb49e956, 0xffca0f1c,
+    0x8a59c52b, 0xfa94c5c1, 0xd3cfc50f, 0xae5adb86, 0xc5476243, 0x853b8621,
+    0x94792c87, 0x61107b4c, 0x2a1a2c80, 0x12bf4390, 0x2688893c, 0x78e4c4a8,
+    0x7bdbe5c2, 0x3ac4eaf4, 0x268a67f7, 0xbf920d2b, 0xa365b193, 0x3d0b7cbd,
+    0xdc51a463, 0xdd27dde1, 0x6919949a, 0x9529a828, 0xce68b4ed, 0x09209f44,
+    0xca984e63, 0x8270237c, 0x7e32b90f, 0x8ef5a7e7, 0x561408f1, 0x212a9db5,
+    0x4d7e6f51, 0x19a5abf9, 0xb5d6df82, 0x61dd9602, 0x36169f3a, 0xc4a1a283,
+    0x6ded727a, 0x8d39a9b8, 0x825c326b, 0x5b2746ed, 0x34007700, 0xd255f4fc,
+    0x4d590180, 0x71e0e13f, 0x89b295f3, 0x64a8f1ae, 0xa74b38fc, 0x4ceab2bb,
+    0x47270bab, 0xc3a734ba, 0x6052dd34, 0xf8563aeb, 0x7e8a31bb, 0x365895b7,
+    0x47f7a994, 0xc3aad392};
+
+// |x| = m * 2^(e - 63), 2^63 <= m < 2^64; |x| >= 2^31 и конечен
+static uint64_t s21_split_mantissa(long double x, int *e) {
+  int big = 0;
+  if (x < 0) x = -x;
+  while (x >= 0x1p1000L) {
+    x *= 0x1p-1000L;
+    big += 1000;
+  }
+  int e0 = (int)((s21_double_bits((double)x) >> 52) & 0x7ff) - 1023;
+  long double m = s21_scale2(x, 63 - e0);
+  if (m < 0x1p63L) {  // (double)x округлилось вверх до степени двойки
+    m *= 2;
+    e0--;
+  }
+  *e = big + e0;
+  return (uint64_t)m;
+}
+
+static int s21_rem_pio2_large(long double x, long double *r) {
+  int e;
+  uint64_t m = s21_split_mantissa(x, &e);
+  int s = e - 63, b = ((s % 32) + 32) % 32, a = (s - b) / 32;
+  // m * 2^b тремя 32-битными частями, младшая первой
+  uint32_t mw[3] = {(uint32_t)(m << b), (uint32_t)(m >> (32 - b)),
+                    (uint32_t)(b ? m >> (64 - b) : 0)};
+  int i0 = a > 1 ? a - 1 : 0;
+  // произведение, младшая часть первой; frac младших частей — дробные
+  uint32_t p[S21_PH_LIMBS] = {0};
+  for (int t = 0; t < S21_PH_WORDS; t++) {
+    uint64_t w = s21_2_pi_bits[i0 + S21_PH_WORDS - 1 - t], carry = 0;
+    for (int j = 0; j < 3 && t + j < S21_PH_LIMBS; j++) {
+      uint64_t cur = (uint64_t)mw[j] * w + p[t + j] + carry;
+      p[t + j] = (uint32_t)cur;
+      carry = cur >> 32;
+    }
+    if (t + 3 < S21_PH_LIMBS) p[t + 3] = (uint32_t)carry;
+  }
+  int frac = i0 + S21_PH_WORDS - a;
+  // округление к ближайшему k: к дроби прибавляется 1/2
+  uint64_t carry = (uint64_t)p[frac - 1] + 0x80000000u;
+  p[frac - 1] = (uint32_t)carry;
+  for (int j = frac; j < S21_PH_LIMBS && (carry >>= 32); j++) {
+    carry += p[j];
+    p[j] = (uint32_t)carry;
+  }
+  int k = frac < S21_PH_LIMBS ? (int)(p[frac] & 3) : 0;
+  // дробь f - 1/2 со знаком: при f < 1/2 берётся модуль 1/2 - f
+  int neg = p[frac - 1] < 0x80000000u;
+  p[frac - 1] -= 0x80000000u;
+  if (neg) {
+    uint64_t borrow = 0;
+    for (int j = 0; j < frac; j++) {
+      uint32_t old = p[j];
+      p[j] = (uint32_t)(0 - old - borrow);
+      borrow = old != 0 || borrow;
+    }
+  }
+  long double f = 0;
+  for (int j = 0; j < frac; j++) f = (f + p[j]) * 0x1p-32L;
+  *r = (neg ? -f : f) * (S21_PI_L / 2);
+  if (x < 0) {
+    *r = -*r;
+    k = -k;
+  }
+  return k & 3;
+}
+
+// x = k * pi/2 + r, |r| <= pi/4 для конечного x; возвращает k mod 4.
+// При |x| < 2^31 — Коди — Уэйт, дальше — Пэйн — Хэнек
+int s21_rem_pio2(long double x, long double *r) {
+  int q;
+  if (x > -2147483648.0L && x < 2147483648.0L) {
+    long double kf = x * S21_2_PI;
+    int64_t k = (int64_t)(kf < 0 ? kf - 0.5L : kf + 0.5L);
+    *r = ((x - k * S21_PIO2_1) - k * S21_PIO2_2) - k * S21_PIO2_3;
+    q = (int)(k & 3);
+  } else {
+    q = s21_rem_pio2_large(x, r);
+  }
+  return q;
+}
+
+long double s21_sin_kernel(long double r) {
+  return r * s21_poly_estrin(s21_sin_coef, 9, r * r);
+}
+
+long double s21_cos_kernel(long double r) {
+  return s21_poly_estrin(s21_cos_coef, 10, r * r);
+}
+
+static long double s21_asin_series(long double s) {
+  return s * s21_poly(s21_asin_coef, 31, s * s);
+}
+
+// asin и acos для |x| <= 1: при |x| > 0.5 через
+// asin|x| = pi/2 - 2 asin(sqrt((1 - |x|) / 2)), где 1 - |x| точно
+long double s21_asin_kernel(long double x) {
+  long double ax = s21_fabsl(x), res;
+  if (ax <= 0.5L) {
+    res = s21_asin_series(x);
+  } else {
+    res = S21_PI_L / 2 - 2 * s21_asin_series(s21_sqrtl((1 - ax) / 2));
+    if (x < 0) res = -res;
+  }
+  return res;
+}
+
+// acos x = 2 asin(sqrt((1 - x) / 2)) при x > 0.5 не вычитает близкие числа
+long double s21_acos_kernel(long double x) {
+  long double res;
+  if (x > 0.5L) {
+    res = 2 * s21_asin_series(s21_sqrtl((1 - x) / 2));
+  } else if (x < -0.5L) {
+    res = S21_PI_L - 2 * s21_asin_series(s21_sqrtl((1 + x) / 2));
+  } else {
+    res = S21_PI_L / 2 - s21_asin_series(x);
+  }
+  return res;
+}
+
+// atan(x) для конечного x >= 0: atan x = pi/2 - atan(1/x) при x > 1 и
+// atan x = pi/6 + atan((x sqrt3 - 1) / (x + sqrt3)) при x > tan(pi/12)
+long double s21_atan_kernel(long double x) {
+  int inv = x > 1;
+  long double base = 0;
+  if (inv) x = 1 / x;
+  if (x > S21_TAN_PI_12) {
+    x = (x * S21_SQRT3 - 1) / (x + S21_SQRT3);
+    base = S21_PI_L / 6;
+  }
+  long double res = base + x * s21_poly_estrin(s21_atan_coef, 15, x * x);
+  return inv ? S21_PI_L / 2 - res : res;
+}
+
+// log(x) = e ln2 + m; для log2 и log10 — те же e и m
+long double s21_log_scaled(long double x, long double ln_2,
+                           long double scale) {
+  long double result;
+  if (x != x || x < 0) {
+    result = S21_NAN;
+  } else if (x == 0) {
+    result = S21_INF_NEG;
+  } else if (x == S21_INF) {
+    result = S21_INF;
+  } else {
+    int e;
+    long double m = s21_log_kernel(x, &e);
+    result = e * ln_2 + m * scale;
+  }
+  return result;
+}
+
+// общее приведение для sin и cos; NaN и бесконечности дают NaN
+void s21_sincos_kernel(long double x, long double *s, long double *c) {
+  if (x != x || S21_IS_INF(x)) {
+    *s = *c = S21_NAN;
+  } else {
+    long double r;
+    int q = s21_rem_pio2(x, &r);
+    long double sr = s21_sin_kernel(r), cr = s21_cos_kernel(r);
+    *s = q % 2 ? cr : sr;
+    *c = q % 2 ? sr : cr;
+    if (q >= 2) *s = -*s;
+    if (q == 1 || q == 2) *c = -*c;
+  }
+}
+
+// угол точки (x, y) в (-pi, pi] с учётом знаков нулей
+long double s21_atan2_kernel(double y, double x) {
+  long double ax = s21_fabs(x), ay = s21_fabs(y), t;
+  if (x != x || y != y) {
+    t = S21_NAN;
+  } else {
+    if (ax == S21_INF && ay == S21_INF) {
+      t = S21_PI_L / 4;
+    } else if (ay == 0 || ax == S21_INF) {
+      t = 0;
+    } else {
+      t = s21_atan_kernel(ay / ax);
+    }
+    if (s21_double_bits(x) >> 63) t = S21_PI_L - t;
+    if (s21_double_bits(y) >> 63) t = -t;
+  }
+  return t;
+}
+
+// sqrt(a^2 + b^2) без переполнения и потери малых значений
+long double s21_hypot_kernel(double a, double b) {
+  long double x = s21_fabs(a), y = s21_fabs(b), res;
+  if (x == S21_INF || y == S21_INF) {
+    res = S21_INF;
+  } else if (x != x || y != y) {
+    res = S21_NAN;
+  } else {
+    if (x < y) {
+      long double t = x;
+      x = y;
+      y = t;
+    }
+    if (x == 0) {
+      res = 0;
+    } else {
+      long double r = y / x;
+      long double q = 1 + r * r;
+      long double s = s21_sqrt_kernel((double)q);
+      res = x * ((s + q / s) / 2);
+    }
+  }
+  return res;
+}
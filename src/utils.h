@@ -1,8 +1,65 @@
 #ifndef UTILS_H
 #define UTILS_H
 
-long int s21_factorial(int x);
+#include <stddef.h>
+#include <stdint.h>
+
+#include "s21_math.h"
+
+#define S21_PI_L 3.14159265358979323846264338328L
+
 long double s21_int_pow(double base, double exp);
 int edge_pow(double base, double exp, long double *result);
 
-#endif
\ No newline at end of file
+uint64_t s21_double_bits(double x);
+double s21_bits_double(uint64_t bits);
+long double s21_poly(const long double *coef, int degree, long double x);
+long double s21_poly_estrin(const long double *coef, int degree,
+                            long double x);
+double s21_prescale(double x, int *scale);
+long double s21_scale2(long double x, int n);
+long double s21_exp_kernel(long double x);
+long double s21_exp2_kernel(long double x);
+long double s21_expm1_kernel(long double x);
+long double s21_log_kernel(long double x, int *exponent);
+long double s21_log1p_kernel(long double x);
+long double s21_log_scaled(long double x, long double ln_2,
+                           long double scale);
+double s21_sqrt_kernel(double x);
+double s21_rsqrt_fast_kernel(double x);
+long double s21_sinpi_kernel(long double x);
+long double s21_lgamma_kernel(long double x, int *sign);
+long double s21_tgamma_kernel(long double x);
+long double s21_erf_kernel(long double x);
+long double s21_erfc_kernel(long double x);
+int s21_rem_pio2(long double x, long double *r);
+long double s21_sin_kernel(long double r);
+long double s21_cos_kernel(long double r);
+long double s21_atan_kernel(long double x);
+long double s21_asin_kernel(long double x);
+long double s21_acos_kernel(long double x);
+void s21_sincos_kernel(long double x, long double *s, long double *c);
+long double s21_atan2_kernel(double y, double x);
+long double s21_hypot_kernel(double a, double b);
+
+// Реализации для автонастройки (s21_tune.c) и выбранное ядро функции
+typedef void (*s21_batch_fn)(const double *x, double *res, size_t n);
+void s21_exp_table_n(const double *x, double *res, size_t n);
+void s21_log_series_n(const double *x, double *res, size_t n);
+void s21_log_table_n(const double *x, double *res, size_t n);
+void s21_sin_poly_n(const double *x, double *res, size_t n);
+void s21_sin_sinpi_n(const double *x, double *res, size_t n);
+void s21_cos_poly_n(const double *x, double *res, size_t n);
+void s21_cos_sinpi_n(const double *x, double *res, size_t n);
+void s21_sqrt_simd_n(const double *x, double *res, size_t n);
+void s21_sqrt_scalar_n(const double *x, double *res, size_t n);
+void s21_rsqrt_simd_n(const double *x, double *res, size_t n);
+void s21_rsqrt_scalar_n(const double *x, double *res, size_t n);
+s21_batch_fn s21_tuned_kernel(s21_tune_fn fn);
+
+// Кэш s21_memo: 1 и результат в *res, если аргументы (a, b) уже считались
+// в этом потоке; без включённого кэша — всегда 0, store ничего не делает
+int s21_memo_find(s21_memo_fn fn, double a, double b, long double *res);
+void s21_memo_store(s21_memo_fn fn, double a, double b, long double res);
+
+#endif